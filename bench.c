@@ -0,0 +1,363 @@
+/*
+ * bench.c - benchmark for layout and render throughput
+ *
+ * Written by Hampus Fridholm
+ *
+ * The benchmark opens a headless screen over /dev/null,
+ * builds synthetic window trees and drives tui_render,
+ * reporting frames per second for each scenario
+ */
+
+#define TUI_IMPLEMENT
+#include "tui.h"
+
+#define DEBUG_IMPLEMENT
+#include "debug.h"
+
+#define BENCH_FRAMES 1000
+
+#define BENCH_TEXT_COUNT 200
+
+#define BENCH_GRID_W 250
+#define BENCH_GRID_H  60
+
+/*
+ * Get current monotonic time in microseconds
+ */
+static long bench_time_us(void)
+{
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return time.tv_sec * 1000000 + time.tv_nsec / 1000;
+}
+
+/*
+ * Report result of scenario
+ */
+static void bench_report(const char* name, int frames, long time_us)
+{
+  double frame_ms = (double) time_us / (double) frames / 1000.0;
+
+  double fps = (time_us > 0) ? (double) frames * 1000000.0 / (double) time_us : 0;
+
+  printf("%-24s %6d frames  %8.3f ms/frame  %10.0f fps\n",
+         name, frames, frame_ms, fps);
+}
+
+/*
+ * Report per-phase breakdown of the last frame
+ */
+static void bench_stats_report(tui_t* tui)
+{
+  tui_stats_t stats = tui_stats_get(tui);
+
+  printf("  last frame: upd %ldus  size %ldus  rect %ldus  render %ldus  windows %zu  cells %zu  nodes %zu\n",
+         stats.update_us, stats.size_calc_us, stats.rect_calc_us, stats.render_us,
+         stats.windows_rendered, stats.cells_written, stats.layout_nodes);
+}
+
+/*
+ * Scenario: N text windows, one string changing per frame
+ */
+static void bench_text_scenario(void)
+{
+  tui_t* tui = tui_create((tui_config_t) { 0 });
+
+  if (!tui)
+  {
+    printf("bench: failed to create tui\n");
+
+    return;
+  }
+
+  tui_window_parent_t* parent = tui_window_parent_create(tui, (tui_window_parent_config_t)
+  {
+    .rect        = TUI_PARENT_RECT,
+    .is_vertical = true,
+  });
+
+  tui_window_text_t* windows[BENCH_TEXT_COUNT];
+
+  char buffer[64];
+
+  for (int index = 0; index < BENCH_TEXT_COUNT; index++)
+  {
+    sprintf(buffer, "text window %d", index);
+
+    windows[index] = tui_parent_child_text_create(parent, (tui_window_text_config_t)
+    {
+      .string = buffer,
+      .rect   = TUI_RECT_NONE,
+    });
+  }
+
+  long start_us = bench_time_us();
+
+  for (int frame = 0; frame < BENCH_FRAMES; frame++)
+  {
+    tui_window_text_t* window = windows[frame % BENCH_TEXT_COUNT];
+
+    if (window)
+    {
+      sprintf(buffer, "frame %d", frame);
+
+      tui_window_text_string_set(window, buffer);
+    }
+
+    tui_render(tui);
+  }
+
+  bench_report("text update", BENCH_FRAMES, bench_time_us() - start_us);
+
+  bench_stats_report(tui);
+
+  tui_delete(&tui);
+}
+
+/*
+ * Scenario: WxH grid with a moving cursor column
+ */
+static void bench_grid_scenario(void)
+{
+  tui_t* tui = tui_create((tui_config_t) { 0 });
+
+  if (!tui)
+  {
+    printf("bench: failed to create tui\n");
+
+    return;
+  }
+
+  tui_window_grid_t* grid = tui_window_grid_create(tui, (tui_window_grid_config_t)
+  {
+    .rect = TUI_PARENT_RECT,
+    .size = (tui_size_t)
+    {
+      .w  = BENCH_GRID_W,
+      .h  = BENCH_GRID_H,
+    },
+  });
+
+  if (!grid)
+  {
+    printf("bench: failed to create grid\n");
+
+    tui_delete(&tui);
+
+    return;
+  }
+
+  long start_us = bench_time_us();
+
+  for (int frame = 0; frame < BENCH_FRAMES; frame++)
+  {
+    int column = frame % BENCH_GRID_W;
+
+    int last_column = (frame + BENCH_GRID_W - 1) % BENCH_GRID_W;
+
+    for (int y = 0; y < BENCH_GRID_H; y++)
+    {
+      // Clear the previous cursor column and draw the new one
+      tui_window_grid_square_set(grid, last_column, y, (tui_window_grid_square_t) { 0 });
+
+      tui_window_grid_square_set(grid, column, y, (tui_window_grid_square_t)
+      {
+        .symbol   = '|',
+        .color.fg = TUI_COLOR_GREEN,
+      });
+    }
+
+    tui_render(tui);
+  }
+
+  bench_report("grid cursor", BENCH_FRAMES, bench_time_us() - start_us);
+
+  bench_stats_report(tui);
+
+  tui_delete(&tui);
+}
+
+/*
+ * Scenario: full relayout and redraw of the text tree every frame
+ */
+static void bench_layout_scenario(void)
+{
+  tui_t* tui = tui_create((tui_config_t) { 0 });
+
+  if (!tui)
+  {
+    printf("bench: failed to create tui\n");
+
+    return;
+  }
+
+  tui_window_parent_t* parent = tui_window_parent_create(tui, (tui_window_parent_config_t)
+  {
+    .rect        = TUI_PARENT_RECT,
+    .is_vertical = true,
+  });
+
+  char buffer[64];
+
+  for (int index = 0; index < BENCH_TEXT_COUNT; index++)
+  {
+    sprintf(buffer, "text window %d", index);
+
+    tui_parent_child_text_create(parent, (tui_window_text_config_t)
+    {
+      .string = buffer,
+      .rect   = TUI_RECT_NONE,
+    });
+  }
+
+  long start_us = bench_time_us();
+
+  for (int frame = 0; frame < BENCH_FRAMES; frame++)
+  {
+    tui_dirty_set(tui);
+
+    tui_render(tui);
+  }
+
+  bench_report("full relayout", BENCH_FRAMES, bench_time_us() - start_us);
+
+  bench_stats_report(tui);
+
+  tui_delete(&tui);
+}
+
+/*
+ * Scenario: assert on rendered output read back off the screen
+ */
+static void bench_readback_scenario(void)
+{
+  tui_t* tui = tui_create((tui_config_t) { 0 });
+
+  if (!tui)
+  {
+    printf("bench: failed to create tui\n");
+
+    return;
+  }
+
+  const char* string = "headless backend";
+
+  tui_window_text_create(tui, (tui_window_text_config_t)
+  {
+    .string = (char*) string,
+    .rect   = TUI_PARENT_RECT,
+  });
+
+  tui_render(tui);
+
+  // Scan the in-memory screen image for the rendered string
+  size_t length = strlen(string);
+
+  bool is_found = false;
+
+  for (int y = 0; y < getmaxy(stdscr) && !is_found; y++)
+  {
+    size_t match = 0;
+
+    for (int x = 0; x < getmaxx(stdscr); x++)
+    {
+      char symbol = tui_headless_cell_get(x, y) & A_CHARTEXT;
+
+      match = (symbol == string[match]) ? match + 1 : 0;
+
+      if (match == length)
+      {
+        is_found = true;
+
+        break;
+      }
+    }
+  }
+
+  printf("%-24s %s\n", "screen readback", is_found ? "found rendered string" : "STRING MISSING");
+
+  tui_delete(&tui);
+}
+
+static int bench_key_count = 0;
+
+/*
+ * Count every scripted key reaching the window
+ */
+static bool bench_key_handler(tui_window_t* head, int key)
+{
+  bench_key_count++;
+
+  return true;
+}
+
+/*
+ * Scenario: scripted keys drive the main loop without a tty
+ */
+static void bench_input_scenario(void)
+{
+  tui_t* tui = tui_create((tui_config_t) { 0 });
+
+  if (!tui)
+  {
+    printf("bench: failed to create tui\n");
+
+    return;
+  }
+
+  tui_window_text_t* window = tui_window_text_create(tui, (tui_window_text_config_t)
+  {
+    .string      = "input",
+    .rect        = TUI_PARENT_RECT,
+    .event.key   = &bench_key_handler,
+    .is_interact = true,
+  });
+
+  tui_window_set(tui, (tui_window_t*) window);
+
+  for (int index = 0; index < BENCH_FRAMES; index++)
+  {
+    tui_key_inject(tui, 'a');
+  }
+
+  tui_key_inject(tui, KEY_CTRLC);
+
+  long start_us = bench_time_us();
+
+  tui_start(tui);
+
+  long time_us = bench_time_us() - start_us;
+
+  printf("%-24s %6d keys    %8.3f us/key    %s\n",
+         "scripted input", bench_key_count,
+         (double) time_us / (double) BENCH_FRAMES,
+         (bench_key_count == BENCH_FRAMES) ? "all dispatched" : "KEYS LOST");
+
+  tui_delete(&tui);
+}
+
+int main(void)
+{
+  if (tui_headless_open() != 0)
+  {
+    printf("bench: failed to open headless screen\n");
+
+    return 1;
+  }
+
+  bench_text_scenario();
+
+  bench_grid_scenario();
+
+  bench_layout_scenario();
+
+  bench_readback_scenario();
+
+  bench_input_scenario();
+
+  tui_headless_close();
+
+  return 0;
+}
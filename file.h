@@ -11,7 +11,19 @@
  *
  * size_t file_size_get(const char* filepath)
  * 
+ * int    file_map(file_map_t* map, const char* filepath)
+ *
+ * void   file_unmap(file_map_t* map)
+ *
  * size_t file_read(void* pointer, size_t size, const char* filepath)
+ *
+ * int    file_appender_open(file_appender_t* appender, const char* filepath)
+ *
+ * size_t file_appender_write(file_appender_t* appender, const void* pointer, size_t size)
+ *
+ * int    file_appender_flush(file_appender_t* appender)
+ *
+ * void   file_appender_close(file_appender_t* appender)
  * 
  * size_t file_write(const void* pointer, size_t size, const char* filepath)
  *
@@ -24,6 +36,12 @@
  *
  * void   file_lines_free(char*** lines, size_t count)
  *
+ * int    file_lines_open(file_lines_t* lines, const char* filepath)
+ *
+ * char*  file_lines_next(file_lines_t* lines, size_t* length)
+ *
+ * void   file_lines_close(file_lines_t* lines)
+ *
  * 
  * int    files_get(char*** files, size_t* count, const char* path, int depth)
  *
@@ -31,6 +49,8 @@
  *
  * size_t files_read(void* pointer, size_t size, char** files, size_t count)
  *
+ * size_t files_pread(void* pointer, size_t size, char** files, size_t count)
+ *
  * void   files_free(char** files, size_t count)
  * 
  * 
@@ -60,11 +80,44 @@
 #define TYPE_DIR  2
 #define TYPE_ELSE 3
 
+/*
+ * Zero-copy read-only view of a file
+ */
+typedef struct file_map_t
+{
+  char*  data; // File contents, not NUL terminated
+  size_t size; // Number of bytes in file
+} file_map_t;
+
+/*
+ * Buffered appender, batching small writes to one file
+ */
+typedef struct file_appender_t
+{
+  int    _fd;
+  char*  _buffer; // Pending bytes not yet written out
+  size_t _size;   // Buffer capacity
+  size_t _used;   // Buffered bytes
+} file_appender_t;
+
+/*
+ * Iterator yielding lines out of a mapped file
+ */
+typedef struct file_lines_t
+{
+  file_map_t _map;   // Mapped file contents
+  size_t     _index; // Read offset into the mapping
+} file_lines_t;
+
 extern char*  path_clean(char* path);
 
 
 extern size_t file_size_get(const char* filepath);
 
+extern int    file_map(file_map_t* map, const char* filepath);
+
+extern void   file_unmap(file_map_t* map);
+
 extern size_t file_read(void* pointer, size_t size, const char* filepath);
 
 extern size_t file_write(const void* pointer, size_t size, const char* filepath);
@@ -78,6 +131,20 @@ extern size_t file_lines_read(char*** lines, size_t size, const char* filepath);
 
 extern void   file_lines_free(char*** lines, size_t count);
 
+extern int    file_lines_open(file_lines_t* lines, const char* filepath);
+
+extern char*  file_lines_next(file_lines_t* lines, size_t* length);
+
+extern void   file_lines_close(file_lines_t* lines);
+
+extern int    file_appender_open(file_appender_t* appender, const char* filepath);
+
+extern size_t file_appender_write(file_appender_t* appender, const void* pointer, size_t size);
+
+extern int    file_appender_flush(file_appender_t* appender);
+
+extern void   file_appender_close(file_appender_t* appender);
+
 
 extern int    files_get(char*** files, size_t* count, const char* path, int depth);
 
@@ -85,6 +152,8 @@ extern size_t files_size_get(char** files, size_t count);
 
 extern size_t files_read(void* pointer, size_t size, char** files, size_t count);
 
+extern size_t files_pread(void* pointer, size_t size, char** files, size_t count);
+
 extern void   files_free(char** files, size_t count);
 
 
@@ -112,8 +181,13 @@ extern int    dir_file_rename(const char* dirpath, const char* old_name, const c
 #include <string.h>
 #include <dirent.h>
 #include <stdlib.h>
+#include <stdbool.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 
 /*
  * Get number of bytes in file
@@ -127,19 +201,80 @@ extern int    dir_file_rename(const char* dirpath, const char* old_name, const c
  */
 size_t file_size_get(const char* filepath)
 {
-  FILE* stream = fopen(filepath, "rb");
+  struct stat file_stat;
 
-  if (!stream) return 0;
+  if (stat(filepath, &file_stat) == -1) return 0;
+
+  return file_stat.st_size;
+}
+
+/*
+ * Map file contents as a zero-copy read-only view
+ *
+ * The view is valid until file_unmap is called
+ *
+ * PARAMS
+ * - file_map_t* map      | Map to store view in
+ * - const char* filepath | Path to file
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to open or map file
+ */
+int file_map(file_map_t* map, const char* filepath)
+{
+  if (!map) return 1;
 
-  fseek(stream, 0, SEEK_END); 
+  *map = (file_map_t) { 0 };
 
-  size_t size = ftell(stream);
+  int fd = open(filepath, O_RDONLY);
 
-  fseek(stream, 0, SEEK_SET); 
+  if (fd == -1) return 1;
 
-  fclose(stream);
+  struct stat file_stat;
 
-  return size;
+  if (fstat(fd, &file_stat) == -1)
+  {
+    close(fd);
+
+    return 1;
+  }
+
+  // An empty file has nothing to map
+  if (file_stat.st_size == 0)
+  {
+    close(fd);
+
+    return 0;
+  }
+
+  char* data = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  // The mapping survives closing the file descriptor
+  close(fd);
+
+  if (data == MAP_FAILED) return 1;
+
+  map->data = data;
+
+  map->size = file_stat.st_size;
+
+  return 0;
+}
+
+/*
+ * Unmap file view
+ *
+ * PARAMS
+ * - file_map_t* map | Map to unmap
+ */
+void file_unmap(file_map_t* map)
+{
+  if (!map || !map->data) return;
+
+  munmap(map->data, map->size);
+
+  *map = (file_map_t) { 0 };
 }
 
 /*
@@ -185,13 +320,15 @@ size_t file_read(void* pointer, size_t size, const char* filepath)
 {
   if (!pointer) return 0;
 
-  FILE* stream = fopen(filepath, "rb");
+  file_map_t map;
 
-  if (!stream) return 0;
+  if (file_map(&map, filepath) != 0) return 0;
 
-  size_t read_size = fread(pointer, 1, size, stream);
+  size_t read_size = (size < map.size) ? size : map.size;
 
-  fclose(stream);
+  memcpy(pointer, map.data, read_size);
+
+  file_unmap(&map);
 
   return read_size;
 }
@@ -226,17 +363,15 @@ size_t file_write(const void* pointer, size_t size, const char* filepath)
 /*
  * Free lines read from file
  *
+ * The lines and their index share one allocation,
+ * so only the index itself has to be freed
+ *
  * Set the pointer to NULL afterwards
  */
 void file_lines_free(char*** lines, size_t count)
 {
   if (!lines || !(*lines)) return;
 
-  for (size_t index = 0; index < count; index++)
-  {
-    free((*lines)[index]);
-  }
-
   free(*lines);
 
   *lines = NULL;
@@ -245,7 +380,8 @@ void file_lines_free(char*** lines, size_t count)
 /*
  * Read lines from file seperated by a new-line character (\n)
  *
- * The allocated memory must be freed by the user
+ * The line index and the lines themselves are stored in
+ * one allocation, which must be freed with file_lines_free
  *
  * RETURN (size_t count)
  * -  0 | Failed to read lines
@@ -253,44 +389,288 @@ void file_lines_free(char*** lines, size_t count)
  */
 size_t file_lines_read(char*** lines, size_t size, const char* filepath)
 {
-  char* buffer = malloc(sizeof(char) * (size + 1));
+  file_map_t map;
+
+  if (file_map(&map, filepath) != 0) return 0;
+
+  size_t read_size = (size < map.size) ? size : map.size;
+
+  // Count the lines up front to size the index
+  size_t count = 0;
+
+  bool is_line = false;
+
+  for (size_t index = 0; index < read_size; index++)
+  {
+    if (map.data[index] == '\n')
+    {
+      is_line = false;
+    }
+    else if (!is_line)
+    {
+      is_line = true;
 
-  if (!buffer) return 0;
+      count++;
+    }
+  }
 
-  if (file_read(buffer, size, filepath) == 0)
+  if (count == 0)
   {
-    free(buffer);
+    file_unmap(&map);
 
     return 0;
   }
 
-  size_t count = 0;
+  char** block = malloc(sizeof(char*) * count + read_size + 1);
+
+  if (!block)
+  {
+    file_unmap(&map);
+
+    return 0;
+  }
 
-  char* token = strtok(buffer, "\n");
+  // The text lives right after the line index
+  char* text = (char*) (block + count);
+
+  memcpy(text, map.data, read_size);
+
+  text[read_size] = '\0';
+
+  file_unmap(&map);
+
+  size_t line_index = 0;
+
+  char* token = strtok(text, "\n");
 
   while (token)
   {
-    char** temp_lines = realloc(*lines, sizeof(char*) * (count + 1));
+    block[line_index++] = token;
+
+    token = strtok(NULL, "\n");
+  }
+
+  *lines = block;
+
+  return count;
+}
+
+/*
+ * Open an iterator yielding lines out of a file
+ *
+ * The lines point straight into the mapping and
+ * are valid until file_lines_close is called
+ *
+ * PARAMS
+ * - file_lines_t* lines    | Iterator to initialize
+ * - const char*   filepath | Path to file
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to map file
+ */
+int file_lines_open(file_lines_t* lines, const char* filepath)
+{
+  if (!lines) return 1;
+
+  lines->_index = 0;
+
+  return file_map(&lines->_map, filepath);
+}
 
-    if (!temp_lines)
+/*
+ * Get the next line from iterator
+ *
+ * The line is not NUL terminated, its length is
+ * stored in length instead
+ *
+ * PARAMS
+ * - file_lines_t* lines  | Iterator to read from
+ * - size_t*       length | Length of line
+ *
+ * RETURN (char* line)
+ * - NULL | No more lines
+ */
+char* file_lines_next(file_lines_t* lines, size_t* length)
+{
+  if (!lines || lines->_index >= lines->_map.size) return NULL;
+
+  char* line = lines->_map.data + lines->_index;
+
+  size_t rest_size = lines->_map.size - lines->_index;
+
+  char* line_end = memchr(line, '\n', rest_size);
+
+  if (line_end)
+  {
+    if (length) *length = line_end - line;
+
+    lines->_index += (line_end - line) + 1;
+  }
+  else
+  {
+    if (length) *length = rest_size;
+
+    lines->_index = lines->_map.size;
+  }
+
+  return line;
+}
+
+/*
+ * Close line iterator and unmap the file
+ *
+ * PARAMS
+ * - file_lines_t* lines | Iterator to close
+ */
+void file_lines_close(file_lines_t* lines)
+{
+  if (!lines) return;
+
+  file_unmap(&lines->_map);
+
+  lines->_index = 0;
+}
+
+// Bytes buffered by an appender before writing out
+#define FILE_APPENDER_BUFFER_SIZE 65536
+
+/*
+ * Open a buffered appender to the end of a file
+ *
+ * Records accumulate in the buffer and are written out
+ * when it fills up, on flush and on close - appending
+ * thousands of small records costs a handful of syscalls
+ *
+ * PARAMS
+ * - file_appender_t* appender | Appender to initialize
+ * - const char*      filepath | Path to file
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to open file or allocate buffer
+ */
+int file_appender_open(file_appender_t* appender, const char* filepath)
+{
+  if (!appender) return 1;
+
+  *appender = (file_appender_t) { ._fd = -1 };
+
+  int fd = open(filepath, O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+  if (fd == -1) return 1;
+
+  char* buffer = malloc(sizeof(char) * FILE_APPENDER_BUFFER_SIZE);
+
+  if (!buffer)
+  {
+    close(fd);
+
+    return 1;
+  }
+
+  appender->_fd     = fd;
+  appender->_buffer = buffer;
+  appender->_size   = FILE_APPENDER_BUFFER_SIZE;
+
+  return 0;
+}
+
+/*
+ * Write out the buffered bytes of appender
+ *
+ * PARAMS
+ * - file_appender_t* appender | Appender to flush
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to write buffer
+ */
+int file_appender_flush(file_appender_t* appender)
+{
+  if (!appender || appender->_fd == -1) return 1;
+
+  size_t write_size = 0;
+
+  while (write_size < appender->_used)
+  {
+    ssize_t status = write(appender->_fd, appender->_buffer + write_size, appender->_used - write_size);
+
+    if (status <= 0) return 1;
+
+    write_size += status;
+  }
+
+  appender->_used = 0;
+
+  return 0;
+}
+
+/*
+ * Append record to file through appender's buffer
+ *
+ * A record larger than the buffer is written out directly
+ *
+ * PARAMS
+ * - file_appender_t* appender | Appender to write to
+ * - const void*      pointer  | Pointer to record
+ * - size_t           size     | Number of bytes in record
+ *
+ * RETURN (size_t write_size)
+ * - 0  | Bad input, or failed to write
+ * - >0 | Number of accepted bytes
+ */
+size_t file_appender_write(file_appender_t* appender, const void* pointer, size_t size)
+{
+  if (!appender || appender->_fd == -1 || !pointer) return 0;
+
+  // Make room for the record
+  if (appender->_used + size > appender->_size)
+  {
+    if (file_appender_flush(appender) != 0) return 0;
+  }
+
+  // A record too big to buffer goes straight out
+  if (size > appender->_size)
+  {
+    size_t write_size = 0;
+
+    while (write_size < size)
     {
-      free(buffer);
+      ssize_t status = write(appender->_fd, pointer + write_size, size - write_size);
 
-      file_lines_free(lines, count);
+      if (status <= 0) return write_size;
 
-      return 0;
+      write_size += status;
     }
 
-    *lines = temp_lines;
+    return write_size;
+  }
 
-    (*lines)[count++] = strdup(token);
+  memcpy(appender->_buffer + appender->_used, pointer, size);
 
-    token = strtok(NULL, "\n");
-  }
+  appender->_used += size;
 
-  free(buffer);
+  return size;
+}
 
-  return count;
+/*
+ * Flush and close appender
+ *
+ * PARAMS
+ * - file_appender_t* appender | Appender to close
+ */
+void file_appender_close(file_appender_t* appender)
+{
+  if (!appender || appender->_fd == -1) return;
+
+  file_appender_flush(appender);
+
+  close(appender->_fd);
+
+  free(appender->_buffer);
+
+  *appender = (file_appender_t) { ._fd = -1 };
 }
 
 /*
@@ -605,81 +985,114 @@ char* path_clean(char* path)
 }
 
 /*
- * Concatonate directory path and child name to get full path
- * 
- * If the dirpath is the current directory, just keep the child name
- *
- * PARAMS
- * - const char* dirpath    | Path to directory
- * - const char* child_name | Name of child (either file or dir)
- *
- * EXPECT
- * - both dirpath and child_name are allocated
- *
- * RETURN (char* fullpath)
+ * Directory waiting to be walked,
+ * referring to a path stored in the walk arena
+ */
+typedef struct walk_dir_t
+{
+  size_t index; // Offset of path in arena
+  int    depth; // Search depth limit left
+} walk_dir_t;
+
+/*
+ * Append string to walk path arena, growing it geometricly
  *
- * Note: Remember to free the allocated memory
+ * RETURN (size_t index)
+ * - (size_t) -1 | Failed to grow arena
  */
-static inline char* full_path_create(const char* dirpath, const char* child_name)
+static inline size_t walk_arena_append(char** arena, size_t* size, size_t* used, const char* string)
 {
-  size_t size = strlen(dirpath) + strlen(child_name) + 2;
+  size_t length = strlen(string);
+
+  while (*used + length + 1 > *size)
+  {
+    char* new_arena = realloc(*arena, *size * 2);
 
-  char* fullpath = malloc(sizeof(char) * size);
+    if (!new_arena) return (size_t) -1;
 
-  sprintf(fullpath, "%s/%s", dirpath, child_name);
+    *arena = new_arena;
 
-  return fullpath;
-}
+    *size *= 2;
+  }
+
+  size_t index = *used;
+
+  memcpy(*arena + index, string, length + 1);
+
+  *used += length + 1;
 
-static inline int dir_files_get(char*** files, size_t* count, const char* dirpath, int depth);
+  return index;
+}
 
 /*
- * Allocate files in directory child - either a file or a new directory
+ * Append child path to walk path arena,
+ * by concatonating directory path and child name
  *
- * PARAMS
- * - char***     files      | Pointer to filepaths
- * - size_t*     count      | Number of files
- * - const char* dirpath    | Path to directory
- * - int         child_type | Type of child - file or dir
- * - const char* child_name | Name of child - filename or dirname
- * - int         depth      | Search depth limit
+ * The directory is referred to by offset,
+ * as growing the arena may move it
  *
- * RETURN (int file_amount)
- * -  0 | Path not to file or dir
- * - >0 | Number of files
+ * RETURN (size_t index)
+ * - (size_t) -1 | Failed to grow arena
  */
-static inline int dir_child_files_get(char*** files, size_t* count, const char* dirpath, int child_type, const char* child_name, int depth)
+static inline size_t walk_path_append(char** arena, size_t* size, size_t* used, size_t dir_index, const char* child_name)
 {
-  switch (child_type)
+  size_t length = strlen(*arena + dir_index) + 1 + strlen(child_name);
+
+  while (*used + length + 1 > *size)
   {
-    case DT_REG:
-      char** new_files = realloc(*files, sizeof(char*) * (*count + 1));
+    char* new_arena = realloc(*arena, *size * 2);
 
-      if (!new_files) return 0;
+    if (!new_arena) return (size_t) -1;
 
-      *files = new_files;
+    *arena = new_arena;
 
-      (*files)[(*count)++] = full_path_create(dirpath, child_name);
+    *size *= 2;
+  }
 
-      return 1;
+  size_t index = *used;
 
-    case DT_DIR:
-      char* fullpath = full_path_create(dirpath, child_name);
+  sprintf(*arena + index, "%s/%s", *arena + dir_index, child_name);
 
-      int new_depth = (depth == -1) ? -1 : (depth - 1);
+  *used += length + 1;
 
-      int file_amount = dir_files_get(files, count, fullpath, new_depth);
+  return index;
+}
 
-      free(fullpath);
+/*
+ * Append copy of file path to geometricly growing array
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to grow array or copy path
+ */
+static inline int files_file_append(char*** files, size_t* count, const char* path)
+{
+  if ((*count == 0) || ((*count & (*count - 1)) == 0))
+  {
+    size_t new_size = (*count == 0) ? 1 : (*count * 2);
 
-      return file_amount;
+    char** new_files = realloc(*files, sizeof(char*) * new_size);
 
-    default: return 0;
+    if (!new_files) return 1;
+
+    *files = new_files;
   }
+
+  char* path_copy = strdup(path);
+
+  if (!path_copy) return 1;
+
+  (*files)[(*count)++] = path_copy;
+
+  return 0;
 }
 
 /*
- * Get and allocate array of files in directory, recursivly
+ * Get and allocate array of files in directory
+ *
+ * The walk is iterative - directories wait on an explicit
+ * stack and every path lives in one append-only arena,
+ * instead of a malloc and sprintf per visited child
  *
  * PARAMS
  * - char***     files   | Pointer to filepaths
@@ -699,23 +1112,103 @@ static inline int dir_files_get(char*** files, size_t* count, const char* dirpat
 {
   if (depth == 0 || depth < -1) return 0;
 
-  struct dirent* dire;
+  size_t arena_size = 1024;
+  size_t arena_used = 0;
 
-  DIR* dirp = opendir(dirpath);
+  char* arena = malloc(sizeof(char) * arena_size);
+
+  if (!arena) return 0;
+
+  size_t dir_size  = 16;
+  size_t dir_count = 0;
+
+  walk_dir_t* dirs = malloc(sizeof(walk_dir_t) * dir_size);
 
-  if (!dirp) return 0;
+  if (!dirs)
+  {
+    free(arena);
+
+    return 0;
+  }
+
+  size_t root_index = walk_arena_append(&arena, &arena_size, &arena_used, dirpath);
+
+  if (root_index == (size_t) -1)
+  {
+    free(dirs);
+
+    free(arena);
+
+    return 0;
+  }
+
+  dirs[dir_count++] = (walk_dir_t) { root_index, depth };
 
   int file_amount = 0;
 
-  while ((dire = readdir(dirp)) != NULL)
+  while (dir_count > 0)
   {
-    // If the child name starts with a dot, it should not be read
-    if (dire->d_name[0] == '.') continue;
+    walk_dir_t dir = dirs[--dir_count];
+
+    DIR* dirp = opendir(arena + dir.index);
+
+    if (!dirp) continue;
+
+    struct dirent* dire;
+
+    while ((dire = readdir(dirp)) != NULL)
+    {
+      // If the child name starts with a dot, it should not be read
+      if (dire->d_name[0] == '.') continue;
+
+      size_t child_index = walk_path_append(&arena, &arena_size, &arena_used, dir.index, dire->d_name);
+
+      if (child_index == (size_t) -1) continue;
+
+      if (dire->d_type == DT_REG)
+      {
+        if (files_file_append(files, count, arena + child_index) == 0)
+        {
+          file_amount++;
+        }
+
+        // File paths are copied out, so the arena can take them back
+        arena_used = child_index;
+      }
+      else if (dire->d_type == DT_DIR && dir.depth != 1)
+      {
+        if (dir_count == dir_size)
+        {
+          walk_dir_t* new_dirs = realloc(dirs, sizeof(walk_dir_t) * dir_size * 2);
+
+          if (!new_dirs)
+          {
+            arena_used = child_index;
+
+            continue;
+          }
 
-    file_amount += dir_child_files_get(files, count, dirpath, dire->d_type, dire->d_name, depth);
+          dirs = new_dirs;
+
+          dir_size *= 2;
+        }
+
+        int new_depth = (dir.depth == -1) ? -1 : (dir.depth - 1);
+
+        dirs[dir_count++] = (walk_dir_t) { child_index, new_depth };
+      }
+      else
+      {
+        arena_used = child_index;
+      }
+    }
+
+    closedir(dirp);
   }
 
-  closedir(dirp);
+  free(dirs);
+
+  free(arena);
 
   return file_amount;
 }
@@ -771,13 +1264,7 @@ int files_get(char*** files, size_t* count, const char* path, int depth)
   switch (path_type_get(path))
   {
     case TYPE_FILE:
-      char** new_files = realloc(*files, sizeof(char*) * (*count + 1));
-
-      if (!new_files) return 0;
-
-      *files = new_files;
-
-      (*files)[(*count)++] = strdup(path);
+      if (files_file_append(files, count, path) != 0) return 0;
 
       return 1;
 
@@ -852,6 +1339,175 @@ size_t files_read(void* pointer, size_t size, char** files, size_t count)
   return read_size;
 }
 
+// Worker threads sharing the parallel bulk read
+#define FILES_PREAD_WORKER_COUNT 4
+
+/*
+ * Shared state of a parallel bulk read
+ */
+typedef struct files_pread_task_t
+{
+  char**          files;
+  size_t          count;
+  char*           buffer;
+  size_t*         offsets;   // Destination offset of each file
+  size_t*         sizes;     // Bytes to read of each file
+  size_t          next;      // Next file index to claim
+  size_t          read_size; // Total bytes read so far
+  pthread_mutex_t mutex;
+} files_pread_task_t;
+
+/*
+ * Read files off the shared task until none are left
+ *
+ * Each worker claims the next file, opens it once and
+ * preads it straight into its precomputed offset
+ */
+static void* files_pread_routine(void* data)
+{
+  files_pread_task_t* task = data;
+
+  size_t local_size = 0;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&task->mutex);
+
+    size_t index = task->next++;
+
+    pthread_mutex_unlock(&task->mutex);
+
+    if (index >= task->count) break;
+
+    size_t file_size = task->sizes[index];
+
+    if (file_size == 0) continue;
+
+    int fd = open(task->files[index], O_RDONLY);
+
+    if (fd == -1) continue;
+
+    size_t file_read_size = 0;
+
+    while (file_read_size < file_size)
+    {
+      ssize_t status = pread(fd, task->buffer + task->offsets[index] + file_read_size,
+                             file_size - file_read_size, file_read_size);
+
+      if (status <= 0) break;
+
+      file_read_size += status;
+    }
+
+    close(fd);
+
+    local_size += file_read_size;
+  }
+
+  pthread_mutex_lock(&task->mutex);
+
+  task->read_size += local_size;
+
+  pthread_mutex_unlock(&task->mutex);
+
+  return NULL;
+}
+
+/*
+ * Read and concatonate multiple files in parallel
+ *
+ * The files are stated once up front to lay them out at fixed
+ * offsets, then a small worker pool preads independent files
+ * concurrently - each file costs one open and overlapping I/O
+ *
+ * Unlike files_read, a file that fails to read leaves its
+ * slot in the buffer untouched instead of compacting it
+ *
+ * PARAMS
+ * - void*  pointer | Pointer to memory buffer
+ * - size_t size    | Number of bytes to read
+ * - char** files   | Filepaths
+ * - size_t count   | Number of files
+ *
+ * RETURN (size_t read_size)
+ * - 0  | Bad input, or files are empty
+ * - >0 | Number of total read bytes
+ */
+size_t files_pread(void* pointer, size_t size, char** files, size_t count)
+{
+  if (!pointer || !files || count == 0) return 0;
+
+  size_t* offsets = malloc(sizeof(size_t) * count * 2);
+
+  if (!offsets) return 0;
+
+  size_t* sizes = offsets + count;
+
+  // Lay the files out back to back, truncated to the buffer
+  size_t offset = 0;
+
+  size_t lay_count = 0;
+
+  for (size_t index = 0; index < count && offset < size; index++)
+  {
+    size_t file_size = file_size_get(files[index]);
+
+    offsets[index] = offset;
+
+    sizes[index] = (offset + file_size > size) ? (size - offset) : file_size;
+
+    offset += sizes[index];
+
+    lay_count++;
+  }
+
+  if (lay_count == 0)
+  {
+    free(offsets);
+
+    return 0;
+  }
+
+  files_pread_task_t task =
+  {
+    .files   = files,
+    .count   = lay_count,
+    .buffer  = pointer,
+    .offsets = offsets,
+    .sizes   = sizes,
+    .mutex   = PTHREAD_MUTEX_INITIALIZER,
+  };
+
+  pthread_t workers[FILES_PREAD_WORKER_COUNT];
+
+  size_t worker_count = 0;
+
+  // One file needs no helpers, the caller reads it alone
+  size_t wanted_count = (lay_count < FILES_PREAD_WORKER_COUNT) ? lay_count - 1 : FILES_PREAD_WORKER_COUNT - 1;
+
+  for (size_t index = 0; index < wanted_count; index++)
+  {
+    if (pthread_create(&workers[index], NULL, &files_pread_routine, &task) != 0)
+    {
+      break;
+    }
+
+    worker_count++;
+  }
+
+  // The caller works alongside the pool
+  files_pread_routine(&task);
+
+  for (size_t index = 0; index < worker_count; index++)
+  {
+    pthread_join(workers[index], NULL);
+  }
+
+  free(offsets);
+
+  return task.read_size;
+}
+
 /*
  * Free the pointers in the files string array
  *
@@ -68,6 +68,10 @@ typedef struct stock_t
  * Function declarations
  */
 
+extern void     stock_init(void);
+
+extern void     stock_quit(void);
+
 extern stock_t* stock_create(char* symbol);
 
 extern int      stock_zoom(stock_t* stock, char* range);
@@ -97,6 +101,25 @@ const char* STOCK_INTERVALS[] = { "1m", "15m", "30m", "1h", "1d" };
 
 #define STOCK_INTERVAL_COUNT (sizeof(STOCK_INTERVALS) / sizeof(char*))
 
+/*
+ * Initialize the stock library
+ *
+ * curl_global_init is not thread safe, so it has to be
+ * called once up front, before any fetching thread exists
+ */
+void stock_init(void)
+{
+  curl_global_init(CURL_GLOBAL_DEFAULT);
+}
+
+/*
+ * Quit the stock library, after every fetch is done
+ */
+void stock_quit(void)
+{
+  curl_global_cleanup();
+}
+
 /*
  * Get index of stock range string
  */
@@ -339,14 +362,10 @@ static inline char* stock_url_create(char* symbol, char* range, char* interval)
  */
 static inline char* stock_response_get(char* symbol, char* range, char* interval)
 {
-  curl_global_init(CURL_GLOBAL_DEFAULT);
-
   CURL* curl = curl_easy_init();
 
   if (!curl)
   {
-    curl_global_cleanup();
-
     return NULL;
   }
 
@@ -354,7 +373,7 @@ static inline char* stock_response_get(char* symbol, char* range, char* interval
 
   if (!response)
   {
-    curl_global_cleanup();
+    curl_easy_cleanup(curl);
 
     return NULL;
   }
@@ -367,7 +386,7 @@ static inline char* stock_response_get(char* symbol, char* range, char* interval
   {
     free(response);
 
-    curl_global_cleanup();
+    curl_easy_cleanup(curl);
 
     return NULL;
   }
@@ -385,8 +404,6 @@ static inline char* stock_response_get(char* symbol, char* range, char* interval
 
   curl_easy_cleanup(curl);
 
-  curl_global_cleanup();
-
   free(url);
 
   if (res == CURLE_OK)
@@ -44,6 +44,10 @@ typedef struct stocks_data_t
   tui_input_t* input;
   tui_list_t*  list;
   stock_t*     stock;
+  char**       symbols;       // Watchlist symbols
+  stock_t**    stocks;        // Fetched stocks, NULL until landed
+  size_t       stock_count;
+  size_t       refresh_index; // Next visible symbol to refresh
 } stocks_data_t;
 
 /*
@@ -59,6 +63,15 @@ void stocks_window_free(tui_window_t* window)
 
   stock_free(&data->stock);
 
+  for (size_t index = 0; index < data->stock_count; index++)
+  {
+    stock_free(&data->stocks[index]);
+  }
+
+  free(data->stocks);
+
+  file_lines_free(&data->symbols, data->stock_count);
+
   free(data);
 }
 
@@ -125,6 +138,12 @@ typedef struct stock_data_t
   int                value_index;
   tui_window_grid_t* chart;
   tui_window_text_t* window;
+
+  tui_window_grid_square_t* base;           // Cached chart base layer
+  tui_size_t                base_size;      // Size base was drawn at
+  stock_t*                  base_stock;     // Stock base was drawn for
+  bool                      base_is_candle; // Style base was drawn in
+  bool                      base_is_stale;  // Series changed since base was drawn
 } stock_data_t;
 
 /*
@@ -134,6 +153,8 @@ void stock_window_free(tui_window_t* head)
 {
   stock_data_t* data = head->data;
 
+  free(data->base);
+
   free(data);
 }
 
@@ -192,30 +213,16 @@ static void chart_window_cursor_render(tui_window_t* head)
 }
 
 /*
- * Render line chart
+ * Draw line chart into grid
  */
-void chart_window_line_render(tui_window_t* head)
+static void chart_window_line_draw(tui_window_t* head)
 {
   tui_window_grid_t* window = (tui_window_grid_t*) head;
   
   stock_data_t* data = head->data;
 
-  if (!data) return;
-
   stock_t* stock = data->stock;
 
-  if (!stock) return;
-
-  tui_size_t size = { .w = head->_rect.w, .h = head->_rect.h };
-
-  if (tui_window_grid_resize(window, size) != 0)
-  {
-    error_print("tui_window_grid_resize");
-  }
-
-  // Limit stock to window size
-  stock_resize(data->stock, (head->_rect.w + 1) / 2);
-
   short color = (stock->_close > stock->_open) ? TUI_COLOR_GREEN : TUI_COLOR_RED;
 
   for (int index = 0; index < stock->_value_count; index++)
@@ -264,38 +271,19 @@ void chart_window_line_render(tui_window_t* head)
       }
     }
   }
-
-  if (head->tui->window == head)
-  {
-    chart_window_cursor_render(head);
-  }
 }
 
 /*
- * Render candlestick chart
+ * Draw candlestick chart into grid
  */
-void chart_window_candle_render(tui_window_t* head)
+static void chart_window_candle_draw(tui_window_t* head)
 {
   tui_window_grid_t* window = (tui_window_grid_t*) head;
   
   stock_data_t* data = head->data;
 
-  if (!data) return;
-
   stock_t* stock = data->stock;
 
-  if (!stock) return;
-
-  tui_size_t size = { .w = head->_rect.w, .h = head->_rect.h };
-
-  if (tui_window_grid_resize(window, size) != 0)
-  {
-    error_print("tui_window_grid_resize");
-  }
-
-  // Limit stock to window size
-  stock_resize(data->stock, (head->_rect.w + 1) / 2);
-
   for (int index = 0; index < stock->_value_count; index++)
   {
     if (index >= stock->_value_count) break;
@@ -347,6 +335,82 @@ void chart_window_candle_render(tui_window_t* head)
       });
     }
   }
+}
+
+/*
+ * Render chart with a cached base layer and a cursor overlay
+ *
+ * The base layer is only redrawn when the stock, the series,
+ * the chart style or the grid size has changed - moving the
+ * cursor just restores the base and paints the overlay, so
+ * the grid diff emits only the cursor cells
+ */
+static void chart_window_render(tui_window_t* head, bool is_candle)
+{
+  tui_window_grid_t* window = (tui_window_grid_t*) head;
+
+  stock_data_t* data = head->data;
+
+  if (!data) return;
+
+  stock_t* stock = data->stock;
+
+  if (!stock) return;
+
+  tui_size_t size = { .w = head->_rect.w, .h = head->_rect.h };
+
+  if (window->_size.w != size.w || window->_size.h != size.h)
+  {
+    if (tui_window_grid_resize(window, size) != 0)
+    {
+      error_print("tui_window_grid_resize");
+
+      return;
+    }
+  }
+
+  size_t square_count = (size_t) size.w * size.h;
+
+  bool is_cached = data->base && !data->base_is_stale &&
+                   data->base_size.w == size.w       &&
+                   data->base_size.h == size.h       &&
+                   data->base_stock  == stock        &&
+                   data->base_is_candle == is_candle;
+
+  if (is_cached)
+  {
+    // Restore base layer, wiping last frame's cursor overlay
+    memcpy(window->grid, data->base, sizeof(tui_window_grid_square_t) * square_count);
+  }
+  else
+  {
+    // Limit stock to window size
+    stock_resize(stock, (head->_rect.w + 1) / 2);
+
+    memset(window->grid, 0, sizeof(tui_window_grid_square_t) * square_count);
+
+    if (is_candle)
+    {
+      chart_window_candle_draw(head);
+    }
+    else
+    {
+      chart_window_line_draw(head);
+    }
+
+    tui_window_grid_square_t* base = realloc(data->base, sizeof(tui_window_grid_square_t) * square_count);
+
+    if (base)
+    {
+      memcpy(base, window->grid, sizeof(tui_window_grid_square_t) * square_count);
+
+      data->base           = base;
+      data->base_size      = size;
+      data->base_stock     = stock;
+      data->base_is_candle = is_candle;
+      data->base_is_stale  = false;
+    }
+  }
 
   if (head->tui->window == head)
   {
@@ -354,6 +418,22 @@ void chart_window_candle_render(tui_window_t* head)
   }
 }
 
+/*
+ * Render line chart
+ */
+void chart_window_line_render(tui_window_t* head)
+{
+  chart_window_render(head, false);
+}
+
+/*
+ * Render candlestick chart
+ */
+void chart_window_candle_render(tui_window_t* head)
+{
+  chart_window_render(head, true);
+}
+
 /*
  * Grid window key event
  */
@@ -378,6 +458,9 @@ bool chart_window_key(tui_window_t* head, int key)
       {
         head->event.render = &chart_window_candle_render;
       }
+
+      tui_window_dirty_set(head);
+
       return true;
 
     case KEY_RIGHT:
@@ -385,6 +468,8 @@ bool chart_window_key(tui_window_t* head, int key)
       {
         data->value_index--;
 
+        tui_window_dirty_set(head);
+
         return true;
       }
 
@@ -397,6 +482,8 @@ bool chart_window_key(tui_window_t* head, int key)
       {
         data->value_index++;
 
+        tui_window_dirty_set(head);
+
         return true;
       }
 
@@ -419,31 +506,55 @@ bool chart_window_key(tui_window_t* head, int key)
     case 'u':
       stock_update(stock);
 
+      data->base_is_stale = true;
+
+      tui_window_dirty_set(head);
+
       return true;
 
     case 'd':
       stock_zoom(stock, "1d");
 
+      data->base_is_stale = true;
+
+      tui_window_dirty_set(head);
+
       return true;
 
     case 'w':
       stock_zoom(stock, "1wk");
 
+      data->base_is_stale = true;
+
+      tui_window_dirty_set(head);
+
       return true;
 
     case 'm':
       stock_zoom(stock, "1mo");
 
+      data->base_is_stale = true;
+
+      tui_window_dirty_set(head);
+
       return true;
 
     case 'y':
       stock_zoom(stock, "1y");
 
+      data->base_is_stale = true;
+
+      tui_window_dirty_set(head);
+
       return true;
 
     case 'x':
       stock_zoom(stock, "max");
 
+      data->base_is_stale = true;
+
+      tui_window_dirty_set(head);
+
       return true;
 
     default:
@@ -468,11 +579,7 @@ void range_window_update(tui_window_t* head)
 
   if (!stock) return;
 
-  char buffer[16];
-
-  sprintf(buffer, "%s", stock->range);
-
-  tui_window_text_string_set(window, buffer);
+  tui_window_text_string_printf(window, "%s", stock->range);
 }
 
 /*
@@ -709,15 +816,11 @@ void data_window_fill(tui_window_t* head)
   if (!stock) return;
   
 
-  char buffer[64];
-
   tui_window_text_t* symbol = tui_window_window_text_search((tui_window_t*) data_window, "data1 values symbol");
 
   if (symbol)
   {
-    sprintf(buffer, "%s", stock->symbol);
-
-    tui_window_text_string_set(symbol, buffer);
+    tui_window_text_string_printf(symbol, "%s", stock->symbol);
   }
 
 
@@ -725,9 +828,7 @@ void data_window_fill(tui_window_t* head)
 
   if (name)
   {
-    sprintf(buffer, "%s", stock->name);
-
-    tui_window_text_string_set(name, buffer);
+    tui_window_text_string_printf(name, "%s", stock->name);
   }
 
 
@@ -735,9 +836,7 @@ void data_window_fill(tui_window_t* head)
 
   if (exchange)
   {
-    sprintf(buffer, "%s", stock->exchange);
-
-    tui_window_text_string_set(exchange, buffer);
+    tui_window_text_string_printf(exchange, "%s", stock->exchange);
   }
 
 
@@ -745,9 +844,7 @@ void data_window_fill(tui_window_t* head)
 
   if (currency)
   {
-    sprintf(buffer, "%s", stock->currency);
-
-    tui_window_text_string_set(currency, buffer);
+    tui_window_text_string_printf(currency, "%s", stock->currency);
   }
 
 
@@ -757,9 +854,7 @@ void data_window_fill(tui_window_t* head)
   {
     if (stock->volume > 0)
     {
-      sprintf(buffer, "%d", stock->volume);
-
-      tui_window_text_string_set(volume, buffer);
+      tui_window_text_string_printf(volume, "%d", stock->volume);
     }
     else
     {
@@ -772,9 +867,7 @@ void data_window_fill(tui_window_t* head)
 
   if (open)
   {
-    sprintf(buffer, "%.2f", stock->open);
-
-    tui_window_text_string_set(open, buffer);
+    tui_window_text_string_printf(open, "%.2f", stock->open);
   }
 
 
@@ -782,9 +875,7 @@ void data_window_fill(tui_window_t* head)
 
   if (high)
   {
-    sprintf(buffer, "%.2f", stock->high);
-
-    tui_window_text_string_set(high, buffer);
+    tui_window_text_string_printf(high, "%.2f", stock->high);
   }
 
 
@@ -792,9 +883,7 @@ void data_window_fill(tui_window_t* head)
 
   if (low)
   {
-    sprintf(buffer, "%.2f", stock->low);
-
-    tui_window_text_string_set(low, buffer);
+    tui_window_text_string_printf(low, "%.2f", stock->low);
   }
 }
 
@@ -1001,6 +1090,12 @@ bool item_window_key(tui_window_t* head, int key)
 {
   stock_t* stock = head->data;
 
+  // The stock is NULL until the async fetch has landed
+  if (!stock)
+  {
+    return false;
+  }
+
   tui_window_parent_t* stock_window = tui_window_window_parent_search(head, ". . . stock");
 
   if (!stock_window)
@@ -1024,6 +1119,8 @@ bool item_window_key(tui_window_t* head, int key)
 
         data->stock = stock;
 
+        data->base_is_stale = true;
+
         tui_window_set(head->tui, (tui_window_t*) data->chart);
 
         tui_window_parent_t* data_window = tui_window_window_parent_search((tui_window_t*) stock_window, "data");
@@ -1045,17 +1142,6 @@ bool item_window_key(tui_window_t* head, int key)
   return false;
 }
 
-/*
- * Free function for item window stock object
- */
-void item_window_free(tui_window_t* head)
-{
-  if (head->data)
-  {
-    stock_free((stock_t**) &head->data);
-  }
-}
-
 /*
  * Render item window, white border when viewing it's chart
  */
@@ -1116,33 +1202,25 @@ void item_window_update(tui_window_t* head)
 
   short color = (stock->close > stock->open) ? TUI_COLOR_GREEN : TUI_COLOR_RED;
 
-  char buffer[64];
-
   tui_window_text_t* symbol_window = tui_window_window_text_search((tui_window_t*) item_window, "symbol");
 
   if (symbol_window)
   {
-    sprintf(buffer, "%s   ", stock->symbol);
-
-    tui_window_text_string_set(symbol_window, buffer);
+    tui_window_text_string_printf(symbol_window, "%s   ", stock->symbol);
   }
 
   tui_window_text_t* price_window = tui_window_window_text_search((tui_window_t*) item_window, "value price");
 
   if (price_window)
   {
-    sprintf(buffer, "%.2f", stock->close);
-
-    tui_window_text_string_set(price_window, buffer);
+    tui_window_text_string_printf(price_window, "%.2f", stock->close);
   }
 
   tui_window_text_t* diff_window = tui_window_window_text_search((tui_window_t*) item_window, "value diff");
 
   if (diff_window)
   {
-    sprintf(buffer, "%+.2f", stock->close - stock->open);
-
-    tui_window_text_string_set(diff_window, buffer);
+    tui_window_text_string_printf(diff_window, "%+.2f", stock->close - stock->open);
 
     diff_window->head.color.fg = color;
   }
@@ -1155,10 +1233,6 @@ void item_window_init(tui_window_t* head)
 {
   tui_window_parent_t* item_window = (tui_window_parent_t*) head;
 
-  stock_t* stock = head->data;
-
-  if (!stock) return;
-
   tui_parent_child_text_create(item_window, (tui_window_text_config_t)
   {
     .name  = "symbol",
@@ -1265,7 +1339,476 @@ bool list_window_key(tui_window_t* head, int key)
 }
 
 /*
- * Initialize list window, creating item windows for default stocks
+ * Binary quote cache, letting cached stocks render instantly
+ * on startup while fresh data is fetched in the background
+ *
+ * Each stock is stored as a fixed size header followed by
+ * its raw value records, so loading is a map and a memcpy
+ */
+
+#define STOCK_CACHE_MAGIC   0x53544B43 // "STKC"
+#define STOCK_CACHE_VERSION 1
+
+typedef struct stock_cache_header_t
+{
+  int    magic;
+  int    version;
+  size_t value_count;
+  int    volume;
+  int    start;
+  int    end;
+  double open;
+  double close;
+  double high;
+  double low;
+  char   name[64];
+  char   exchange[32];
+  char   currency[16];
+  char   range[8];
+  char   interval[8];
+} stock_cache_header_t;
+
+/*
+ * Get path to quote cache directory, creating it if missing
+ */
+int stock_cache_dir_get(char* dirpath, size_t size)
+{
+  if (snprintf(dirpath, size, "%s/.stocks/cache", getenv("HOME")) < 0)
+  {
+    return 1;
+  }
+
+  mkdir(dirpath, 0755);
+
+  return 0;
+}
+
+/*
+ * Store stock values in quote cache
+ */
+int stock_cache_store(stock_t* stock)
+{
+  if (!stock || !stock->symbol || !stock->values) return 1;
+
+  char dirpath[128];
+
+  if (stock_cache_dir_get(dirpath, sizeof(dirpath)) != 0) return 1;
+
+  size_t values_size = sizeof(stock_value_t) * stock->value_count;
+
+  size_t size = sizeof(stock_cache_header_t) + values_size;
+
+  char* buffer = malloc(size);
+
+  if (!buffer) return 1;
+
+  stock_cache_header_t header = (stock_cache_header_t)
+  {
+    .magic       = STOCK_CACHE_MAGIC,
+    .version     = STOCK_CACHE_VERSION,
+    .value_count = stock->value_count,
+    .volume      = stock->volume,
+    .start       = stock->start,
+    .end         = stock->end,
+    .open        = stock->open,
+    .close       = stock->close,
+    .high        = stock->high,
+    .low         = stock->low,
+  };
+
+  snprintf(header.name,     sizeof(header.name),     "%s", stock->name     ? stock->name     : "");
+  snprintf(header.exchange, sizeof(header.exchange), "%s", stock->exchange ? stock->exchange : "");
+  snprintf(header.currency, sizeof(header.currency), "%s", stock->currency ? stock->currency : "");
+  snprintf(header.range,    sizeof(header.range),    "%s", stock->range    ? stock->range    : "");
+  snprintf(header.interval, sizeof(header.interval), "%s", stock->interval ? stock->interval : "");
+
+  memcpy(buffer, &header, sizeof(header));
+
+  memcpy(buffer + sizeof(header), stock->values, values_size);
+
+  char name[80];
+
+  snprintf(name, sizeof(name), "%s.quotes", stock->symbol);
+
+  size_t write_size = dir_file_write(buffer, size, dirpath, name);
+
+  free(buffer);
+
+  return (write_size == size) ? 0 : 1;
+}
+
+/*
+ * Load stock values from quote cache
+ *
+ * RETURN (stock_t* stock)
+ * - NULL | Symbol is not cached, or cache is stale garbage
+ */
+stock_t* stock_cache_load(const char* symbol)
+{
+  char dirpath[128];
+
+  if (stock_cache_dir_get(dirpath, sizeof(dirpath)) != 0) return NULL;
+
+  char filepath[256];
+
+  snprintf(filepath, sizeof(filepath), "%s/%s.quotes", dirpath, symbol);
+
+  file_map_t map;
+
+  if (file_map(&map, filepath) != 0) return NULL;
+
+  if (map.size < sizeof(stock_cache_header_t))
+  {
+    file_unmap(&map);
+
+    return NULL;
+  }
+
+  stock_cache_header_t header;
+
+  memcpy(&header, map.data, sizeof(header));
+
+  // The value count has to match the file length exactly
+  size_t values_size = map.size - sizeof(header);
+
+  if (header.magic       != STOCK_CACHE_MAGIC   ||
+      header.version     != STOCK_CACHE_VERSION ||
+      header.value_count == 0                   ||
+      values_size % sizeof(stock_value_t) != 0  ||
+      header.value_count != values_size / sizeof(stock_value_t))
+  {
+    file_unmap(&map);
+
+    return NULL;
+  }
+
+  // The string fields come from disk, so nothing
+  // guarantees their termination before the strdups
+  header.name    [sizeof(header.name)     - 1] = '\0';
+  header.exchange[sizeof(header.exchange) - 1] = '\0';
+  header.currency[sizeof(header.currency) - 1] = '\0';
+  header.range   [sizeof(header.range)    - 1] = '\0';
+  header.interval[sizeof(header.interval) - 1] = '\0';
+
+  stock_t* stock = malloc(sizeof(stock_t));
+
+  if (!stock)
+  {
+    file_unmap(&map);
+
+    return NULL;
+  }
+
+  *stock = (stock_t)
+  {
+    .symbol   = strdup(symbol),
+    .name     = strdup(header.name),
+    .exchange = strdup(header.exchange),
+    .currency = strdup(header.currency),
+    .range    = strdup(header.range),
+    .interval = strdup(header.interval),
+    .volume   = header.volume,
+    .start    = header.start,
+    .end      = header.end,
+    .open     = header.open,
+    .close    = header.close,
+    .high     = header.high,
+    .low      = header.low,
+  };
+
+  stock->values = malloc(values_size);
+
+  if (!stock->values)
+  {
+    stock_free(&stock);
+
+    file_unmap(&map);
+
+    return NULL;
+  }
+
+  memcpy(stock->values, map.data + sizeof(header), values_size);
+
+  stock->value_count = header.value_count;
+
+  file_unmap(&map);
+
+  if (stock_resize(stock, stock->value_count) != 0)
+  {
+    stock_free(&stock);
+
+    return NULL;
+  }
+
+  return stock;
+}
+
+/*
+ * Async stock fetch job data
+ */
+typedef struct fetch_data_t
+{
+  char*         symbol;
+  size_t        index;  // Index in the stocks array
+  tui_window_t* window; // Window that requested the fetch
+} fetch_data_t;
+
+/*
+ * Fetch stock on a worker thread
+ */
+void* stock_fetch_work(void* data)
+{
+  fetch_data_t* fetch = data;
+
+  stock_t* stock = stock_create(fetch->symbol);
+
+  // Cache the fresh values, still on the worker thread
+  if (stock)
+  {
+    stock_cache_store(stock);
+  }
+
+  return stock;
+}
+
+/*
+ * Bind pooled item window to the stock of a data item
+ */
+void item_window_bind(tui_list_t* list, tui_window_t* head, size_t index)
+{
+  tui_window_parent_t* list_window = head->parent;
+
+  stocks_data_t* data = list_window ? list_window->head.data : NULL;
+
+  if (!data) return;
+
+  head->data = data->stocks[index];
+
+  tui_window_text_t* symbol_window = tui_window_window_text_search(head, "symbol");
+
+  if (symbol_window)
+  {
+    tui_window_text_string_set(symbol_window, data->symbols[index]);
+  }
+
+  // Clear the values of a stock whose fetch hasn't landed
+  if (!head->data)
+  {
+    tui_window_text_t* price_window = tui_window_window_text_search(head, "value price");
+
+    if (price_window)
+    {
+      tui_window_text_string_set(price_window, "");
+    }
+
+    tui_window_text_t* diff_window = tui_window_window_text_search(head, "value diff");
+
+    if (diff_window)
+    {
+      tui_window_text_string_set(diff_window, "");
+    }
+  }
+
+  tui_window_dirty_set(head);
+}
+
+/*
+ * Store fetched stock, when its fetch has landed,
+ * and rebind the item window showing it
+ */
+void item_fetch_done(tui_t* tui, void* data, void* result)
+{
+  fetch_data_t* fetch = data;
+
+  stock_t* stock = result;
+
+  tui_window_t* head = fetch->window;
+
+  size_t index = fetch->index;
+
+  free(fetch->symbol);
+
+  free(fetch);
+
+  if (!stock)
+  {
+    return;
+  }
+
+  stocks_data_t* stocks_data = head->data;
+
+  if (!stocks_data)
+  {
+    stock_free(&stock);
+
+    return;
+  }
+
+  stock_t* old_stock = stocks_data->stocks[index];
+
+  // The chart may be showing the cached stock being replaced
+  tui_window_parent_t* stock_window = tui_window_window_parent_search(head, ". . stock");
+
+  stock_data_t* stock_data = stock_window ? stock_window->head.data : NULL;
+
+  if (stock_data && old_stock && stock_data->stock == old_stock)
+  {
+    stock_data->stock = stock;
+
+    stock_data->base_is_stale = true;
+
+    if (stock_data->chart)
+    {
+      tui_window_dirty_set((tui_window_t*) stock_data->chart);
+    }
+  }
+
+  // The fresh stock replaces the cached one
+  stock_free(&stocks_data->stocks[index]);
+
+  stocks_data->stocks[index] = stock;
+
+  tui_list_data_update(stocks_data->list, index);
+}
+
+// Recycled item windows covering the viewport plus margin
+#define LIST_POOL_COUNT 32
+
+// Interval between background refresh ticks
+#define STOCKS_REFRESH_INTERVAL_MS 15000
+
+// Symbols refreshed per tick, staggering the requests
+#define STOCKS_REFRESH_BATCH_COUNT 4
+
+/*
+ * Store refreshed stock, when its background fetch has landed
+ *
+ * Only items whose price actually moved are repainted -
+ * an unchanged quote leaves its item window clean
+ */
+void refresh_fetch_done(tui_t* tui, void* data, void* result)
+{
+  fetch_data_t* fetch = data;
+
+  stock_t* stock = result;
+
+  tui_window_t* head = fetch->window;
+
+  size_t index = fetch->index;
+
+  free(fetch->symbol);
+
+  free(fetch);
+
+  if (!stock)
+  {
+    return;
+  }
+
+  stocks_data_t* stocks_data = head->data;
+
+  if (!stocks_data)
+  {
+    stock_free(&stock);
+
+    return;
+  }
+
+  stock_t* old_stock = stocks_data->stocks[index];
+
+  bool is_changed = !old_stock ||
+                    old_stock->close != stock->close ||
+                    old_stock->open  != stock->open;
+
+  if (!is_changed)
+  {
+    // The price didn't move, so the bound stock stays
+    stock_free(&stock);
+
+    return;
+  }
+
+  // The chart may be showing the stock being replaced
+  tui_window_parent_t* stock_window = tui_window_window_parent_search(head, ". . stock");
+
+  stock_data_t* stock_data = stock_window ? stock_window->head.data : NULL;
+
+  if (stock_data && old_stock && stock_data->stock == old_stock)
+  {
+    stock_data->stock = stock;
+
+    stock_data->base_is_stale = true;
+
+    if (stock_data->chart)
+    {
+      tui_window_dirty_set((tui_window_t*) stock_data->chart);
+    }
+  }
+
+  stock_free(&stocks_data->stocks[index]);
+
+  stocks_data->stocks[index] = stock;
+
+  tui_list_data_update(stocks_data->list, index);
+}
+
+/*
+ * Refresh a batch of visible watchlist stocks
+ *
+ * Each timer tick refetches the next few visible symbols,
+ * staggering the requests instead of bursting them all
+ */
+void stocks_refresh_event(tui_t* tui, tui_timer_t* timer)
+{
+  tui_window_t* head = timer->data;
+
+  stocks_data_t* data = head->data;
+
+  if (!data || data->stock_count == 0) return;
+
+  tui_list_t* list = data->list;
+
+  size_t first = list->_data_first;
+
+  size_t visible_count = MIN(list->item_count, data->stock_count - first);
+
+  if (visible_count == 0) return;
+
+  for (size_t batch = 0; batch < STOCKS_REFRESH_BATCH_COUNT; batch++)
+  {
+    size_t index = first + (data->refresh_index++ % visible_count);
+
+    fetch_data_t* fetch = malloc(sizeof(fetch_data_t));
+
+    if (!fetch) break;
+
+    *fetch = (fetch_data_t)
+    {
+      .symbol = strdup(data->symbols[index]),
+      .index  = index,
+      .window = head
+    };
+
+    if (tui_async_submit(tui, &stock_fetch_work, &refresh_fetch_done, fetch) != 0)
+    {
+      free(fetch->symbol);
+
+      free(fetch);
+
+      break;
+    }
+  }
+}
+
+/*
+ * Initialize list window for the default stocks
+ *
+ * The list is virtual: a small pool of item windows is bound
+ * to the visible part of the watchlist and rebound while
+ * scrolling, so layout cost is independent of list length
+ *
+ * The stocks are fetched concurrently,
+ * filling in prices as each fetch lands
  */
 void list_window_init(tui_window_t* head)
 {
@@ -1283,37 +1826,68 @@ void list_window_init(tui_window_t* head)
 
   size_t count = file_lines_read(&symbols, file_size, stocks_file);
 
+  data->symbols = symbols;
+
+  data->stock_count = count;
+
+  data->stocks = calloc(count + 1, sizeof(stock_t*));
+
+  // Cached stocks render instantly, ahead of any network fetch
   for (size_t index = 0; index < count; index++)
   {
-    char* symbol = symbols[index];
-
-    stock_t* stock = stock_create(symbol);
+    data->stocks[index] = stock_cache_load(symbols[index]);
+  }
 
-    if (!stock) continue;
+  size_t pool_count = MIN(count, LIST_POOL_COUNT);
 
+  for (size_t index = 0; index < pool_count; index++)
+  {
     tui_window_parent_t* item_window = tui_parent_child_parent_create(list_window, (tui_window_parent_config_t)
     {
-      .name         = symbol,
       .rect         = TUI_RECT_NONE,
       .border       = (tui_border_t)
       {
         .is_active  = true,
       },
       .event.init   = &item_window_init,
-      .event.free   = &item_window_free,
       .event.key    = &item_window_key,
       .event.update = &item_window_update,
       .event.render = &item_window_render,
-      .data         = stock,
       .align        = TUI_ALIGN_BETWEEN,
       .w_grow       = true,
       .is_atomic    = true,
     });
 
+    if (!item_window) continue;
+
     tui_list_item_add(data->list, (tui_window_t*) item_window);
   }
 
-  file_lines_free(&symbols, count);
+  tui_list_virtual_set(data->list, count, &item_window_bind);
+
+  for (size_t index = 0; index < count; index++)
+  {
+    fetch_data_t* fetch = malloc(sizeof(fetch_data_t));
+
+    if (!fetch) continue;
+
+    *fetch = (fetch_data_t)
+    {
+      .symbol = strdup(symbols[index]),
+      .index  = index,
+      .window = head
+    };
+
+    if (tui_async_submit(head->tui, &stock_fetch_work, &item_fetch_done, fetch) != 0)
+    {
+      free(fetch->symbol);
+
+      free(fetch);
+    }
+  }
+
+  // Keep the visible watchlist current while the app idles
+  tui_timer_create(head->tui, STOCKS_REFRESH_INTERVAL_MS, &stocks_refresh_event, head);
 
   // Creating invisable window to give list window some min structure
   tui_parent_child_text_create(list_window, (tui_window_text_config_t)
@@ -1357,24 +1931,69 @@ void search_window_exit(tui_window_t* head)
 }
 
 /*
- * Keypress handler for search window, on enter view inputted stock's chart
+ * Show chart of searched stock, when its fetch has landed
  */
-bool search_window_key(tui_window_t* head, int key)
+void search_fetch_done(tui_t* tui, void* data, void* result)
 {
+  fetch_data_t* fetch = data;
+
+  stock_t* stock = result;
+
+  tui_window_t* head = fetch->window;
+
+  free(fetch->symbol);
+
+  free(fetch);
+
+  if (!stock)
+  {
+    return;
+  }
+
   tui_window_parent_t* stock_window = tui_window_window_parent_search(head, ". . stock");
 
-  if (!stock_window)
+  stock_data_t* stock_data = stock_window ? stock_window->head.data : NULL;
+
+  stocks_data_t* stocks_data = head->data;
+
+  if (!stock_data || !stocks_data)
   {
-    return false;
+    stock_free(&stock);
+
+    return;
   }
 
-  stock_data_t* stock_data = stock_window->head.data;
+  stock_free(&stocks_data->stock);
+
+  stocks_data->stock = stock;
 
-  if (!stock_data)
+  stock_data->stock = stocks_data->stock;
+
+  stock_data->base_is_stale = true;
+
+  tui_window_grid_t* chart_window = stock_data->chart;
+
+  if (chart_window)
   {
-    return false;
+    tui_window_set(tui, (tui_window_t*) chart_window);
+
+    tui_window_parent_t* data_window = tui_window_window_parent_search((tui_window_t*) stock_window, "data");
+
+    if (data_window)
+    {
+      data_window_fill((tui_window_t*) data_window);
+    }
   }
+}
 
+/*
+ * Keypress handler for search window, on enter view inputted stock's chart
+ *
+ * The stock is fetched on a worker thread,
+ * so the interface stays responsive during the fetch
+ */
+bool search_window_key(tui_window_t* head, int key)
+{
   stocks_data_t* data = head->data;
 
   if (!data)
@@ -1384,33 +2003,24 @@ bool search_window_key(tui_window_t* head, int key)
 
   if (key == KEY_ENTR)
   {
-    char* symbol = data->input->buffer;
+    fetch_data_t* fetch = malloc(sizeof(fetch_data_t));
 
-    stock_t* stock = stock_create(symbol);
-
-    if (!stock)
+    if (!fetch)
     {
       return true;
     }
 
-    stock_free(&data->stock);
-
-    data->stock = stock;
-
-    stock_data->stock = data->stock;
-
-    tui_window_grid_t* chart_window = stock_data->chart;
-
-    if (chart_window)
+    *fetch = (fetch_data_t)
     {
-      tui_window_set(head->tui, (tui_window_t*) chart_window);
+      .symbol = strdup(tui_input_buffer_get(data->input)),
+      .window = head
+    };
 
-      tui_window_parent_t* data_window = tui_window_window_parent_search((tui_window_t*) stock_window, "data");
+    if (tui_async_submit(head->tui, &stock_fetch_work, &search_fetch_done, fetch) != 0)
+    {
+      free(fetch->symbol);
 
-      if (data_window)
-      {
-        data_window_fill((tui_window_t*) data_window);
-      }
+      free(fetch);
     }
 
     return true;
@@ -1430,7 +2040,7 @@ void search_window_update(tui_window_t* head)
 
   if (text_window)
   {
-    tui_window_text_string_set(text_window, data->input->string);
+    tui_window_text_string_set(text_window, tui_input_string_get(data->input));
   }
 }
 
@@ -1610,6 +2220,9 @@ int main(int argc, char* argv[])
 
   debug_file_open(debug_file);
 
+  // curl's global state has to exist before any fetch thread
+  stock_init();
+
   tui_t* tui = tui_create((tui_config_t)
   {
     .event.key  = &tab_event,
@@ -1618,6 +2231,8 @@ int main(int argc, char* argv[])
 
   if (!tui)
   {
+    stock_quit();
+
     debug_file_close();
 
     return 2;
@@ -1629,6 +2244,8 @@ int main(int argc, char* argv[])
 
   tui_delete(&tui);
 
+  stock_quit();
+
   debug_file_close();
 
   return 0;
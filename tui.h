@@ -10,6 +10,7 @@
 #define TUI_H
 
 #include <ncurses.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -41,6 +42,8 @@ typedef struct tui_menu_t tui_menu_t;
 
 typedef struct tui_window_t tui_window_t;
 
+typedef struct tui_timer_t tui_timer_t;
+
 /*
  * Window event struct
  *
@@ -126,6 +129,10 @@ typedef struct tui_color_t
  * Definitions of colors
  *
  * These colors differ from ncurses colors by 1
+ *
+ * Values above TUI_COLOR_WHITE follow the same rule, so any
+ * extended ncurses color n can be used as the value n + 1 -
+ * for example 256-color gradients in charts
  */
 enum {
   TUI_COLOR_NONE,
@@ -182,12 +189,17 @@ typedef struct tui_window_t
   bool                 is_atomic;
   bool                 is_hidden;
   bool                 _is_visable;
+  bool                 _is_dirty;  // Window content has changed
+  bool                 _has_dirty; // Some child window is dirty
   bool                 is_interact;
   bool                 is_contain;
   bool                 w_grow;
   bool                 h_grow;
   tui_rect_t           rect;
-  tui_rect_t           _rect;  // Temp calculated rect
+  tui_rect_t           _rect;       // Temp calculated rect
+  tui_rect_t           _size_cache; // Last calculated preliminary size
+  tui_rect_t           _rect_cache; // Last calculated final rect
+  bool                 _is_cached;  // _size_cache holds a valid size
   WINDOW*              window;
   tui_color_t          color;
   tui_color_t          _color; // Temp inherited color
@@ -203,19 +215,23 @@ typedef struct tui_window_t
  */
 typedef struct tui_input_t
 {
-  char*              buffer;
+  char*              buffer;      // Gap buffer, the gap sits at the cursor
   size_t             buffer_size;
-  size_t             buffer_len;
-  size_t             cursor;
+  size_t             _gap_start;  // Cursor position
+  size_t             _gap_end;
   size_t             scroll;
   tui_window_text_t* window;
-  char*              string; // Visable string
+  char*              string;      // Visable string
+  char*              _text;       // Contiguous copy of buffer
+  bool               _is_dirty;   // Visable string needs regenerating
   tui_t*             tui;
 } tui_input_t;
 
 /*
  * List data struct, that can be attached to window
  */
+typedef struct tui_list_t tui_list_t;
+
 typedef struct tui_list_t
 {
   tui_window_t** items;
@@ -223,6 +239,12 @@ typedef struct tui_list_t
   size_t         item_index;
   bool           is_vertical;
   tui_t*         tui;
+  // Virtual mode: the item windows are a recycled pool
+  // over a data source, rebound while scrolling
+  void (*bind) (tui_list_t* list, tui_window_t* item, size_t data_index);
+  size_t         data_count; // Items in the data source
+  size_t         data_index; // Selected data item
+  size_t         _data_first; // Data item bound to the first pooled window
 } tui_list_t;
 
 /*
@@ -266,20 +288,39 @@ typedef struct tui_window_grid_t
   tui_size_t                size;
   tui_size_t                _size;
   tui_window_grid_square_t* grid;
+  size_t                    _grid_capacity; // Allocated squares, grow-only
+  tui_window_grid_square_t* _shadow;        // Squares as they were last rendered
+  tui_color_t               _shadow_color;
 } tui_window_grid_t;
 
+/*
+ * Compiled ANSI code at a position in extracted text
+ */
+typedef struct tui_text_token_t
+{
+  size_t index; // Position in extracted text
+  short  code;  // ANSI code
+} tui_text_token_t;
+
 /*
  * Text window struct
+ *
+ * text and tokens are compiled from string when it is set
  */
 typedef struct tui_window_text_t
 {
-  tui_window_t head;
-  char*        string;
-  size_t       string_size;
-  char*        text;
-  bool         is_secret;
-  tui_pos_t    pos;
-  tui_align_t  align;
+  tui_window_t      head;
+  char*             string;
+  size_t            string_size;
+  char*             text;
+  tui_text_token_t* tokens;
+  size_t            token_count;
+  int*              line_ws;     // Cached widths of wrapped lines
+  int               line_count;  // Number of cached lines
+  int               line_w;      // Width the lines were wrapped for
+  bool              is_secret;
+  tui_pos_t         pos;
+  tui_align_t       align;
 } tui_window_text_t;
 
 /*
@@ -322,6 +363,93 @@ typedef struct tui_cursor_t
   int  y;
 } tui_cursor_t;
 
+/*
+ * Timer struct
+ *
+ * The timer fires repeatedly with a fixed interval,
+ * driven by the main loop in tui_start
+ */
+typedef struct tui_timer_t
+{
+  int    interval_ms;
+  long   _expire_ms; // Next expiry in monotonic time
+  void (*event) (tui_t* tui, tui_timer_t* timer);
+  tui_t* tui;
+  void*  data;       // User attached data
+} tui_timer_t;
+
+/*
+ * Async job struct
+ *
+ * work runs on a worker thread,
+ * done runs afterwards on the main loop
+ */
+typedef struct tui_async_t tui_async_t;
+
+typedef struct tui_async_t
+{
+  void* (*work) (void* data);
+  void  (*done) (tui_t* tui, void* data, void* result);
+  void*        data;
+  void*        result;
+  tui_async_t* next;
+} tui_async_t;
+
+#define TUI_ASYNC_WORKER_COUNT 4
+
+/*
+ * Cached window search slot
+ *
+ * Memoizes a resolved search path from a base window,
+ * so repeated searches from update handlers are O(1)
+ */
+typedef struct tui_search_slot_t
+{
+  tui_window_t* base;
+  char*         search;
+  tui_window_t* window;
+  size_t        generation;
+} tui_search_slot_t;
+
+#define TUI_SEARCH_CACHE_SIZE 256
+
+/*
+ * Frame statistics struct
+ *
+ * Per-frame counters and phase times of the last
+ * rendered frame, queryable through tui_stats_get
+ */
+typedef struct tui_stats_t
+{
+  size_t frame_count;      // Frames rendered since start
+  long   frame_us;         // Total time of the last frame
+  long   frame_avg_us;     // Rolling average frame time
+  long   update_us;        // Time spent in update handlers
+  long   size_calc_us;     // Time spent in the size phase
+  long   rect_calc_us;     // Time spent in the rect phase
+  long   render_us;        // Time spent emitting output
+  size_t windows_rendered; // Windows rendered last frame
+  size_t cells_written;    // Cells emitted last frame
+  size_t layout_nodes;     // Windows whose size was recomputed
+  size_t arena_bytes;      // Bytes carved out of the arena
+} tui_stats_t;
+
+/*
+ * Arena block struct
+ *
+ * The window structs are carved out of chained blocks,
+ * which are freed in one shot by tui_delete
+ */
+typedef struct tui_arena_block_t tui_arena_block_t;
+
+typedef struct tui_arena_block_t
+{
+  tui_arena_block_t* next;
+  size_t             size;
+  size_t             used;
+  char               data[];
+} tui_arena_block_t;
+
 /*
  * Tui struct
  */
@@ -337,7 +465,27 @@ typedef struct tui_t
   tui_color_t    color;
   tui_cursor_t   cursor;
   tui_event_t    event;
+  tui_timer_t**  timers;
+  size_t         timer_count;
+  int            _wake_fds[2]; // Wakeup pipe for cross-thread notification
+  int*           _key_queue;   // Scripted keys, consumed before the terminal
+  size_t         _key_count;
+  size_t         _key_index;   // Next scripted key to consume
+  tui_async_t*   _async_jobs;  // Jobs waiting for a worker
+  tui_async_t*   _async_dones; // Completed jobs waiting for the main loop
+  pthread_t      _async_workers[TUI_ASYNC_WORKER_COUNT];
+  size_t         _async_worker_count;
+  pthread_mutex_t _async_mutex;
+  pthread_cond_t  _async_cond;
+  bool           _async_is_quitting;
   bool           is_running;
+  bool           _is_dirty; // Some window is dirty
+  bool           _is_full;  // Everything has to be redrawn
+  tui_search_slot_t _search_cache[TUI_SEARCH_CACHE_SIZE];
+  size_t            _search_generation; // Bumped when the window tree changes
+  tui_arena_block_t* _arena;
+  tui_stats_t        _stats;
+  bool               is_stats_shown; // Draw the stats overlay
 } tui_t;
 
 #endif // TUI_H
@@ -345,18 +493,81 @@ typedef struct tui_t
 #ifdef TUI_IMPLEMENT
 
 #include <stdlib.h>
+#include <stdarg.h>
 #include <errno.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
 
 #include "debug.h"
 
+#define TUI_COLOR_PAIR_CACHE_SIZE 256
+
 /*
- * Get ncurses color index from tui color
+ * Color pair slot, mapping a fg and bg combination
+ * to a lazily allocated ncurses pair
+ */
+typedef struct tui_color_pair_t
+{
+  short fg;
+  short bg;
+  short pair; // 0 means the slot is empty
+} tui_color_pair_t;
+
+static tui_color_pair_t tui_color_pairs[TUI_COLOR_PAIR_CACHE_SIZE] = { 0 };
+
+static short tui_color_pair_count = 0;
+
+/*
+ * Get ncurses color pair of tui color
+ *
+ * Pairs are init_pair'd lazily on first use and cached in an
+ * open addressed table, so lookups on the render path are O(1)
+ * and unused combinations never allocate a pair - this also
+ * admits extended colors beyond the eight named ones
  */
 static inline short tui_color_index_get(tui_color_t color)
 {
-  return color.fg * 9 + color.bg;
+  // Full transparency is the default pair
+  if (color.fg == TUI_COLOR_NONE && color.bg == TUI_COLOR_NONE)
+  {
+    return 0;
+  }
+
+  size_t hash = ((size_t) (unsigned short) color.fg * 31 + (unsigned short) color.bg) % TUI_COLOR_PAIR_CACHE_SIZE;
+
+  for (size_t probe = 0; probe < TUI_COLOR_PAIR_CACHE_SIZE; probe++)
+  {
+    tui_color_pair_t* slot = &tui_color_pairs[(hash + probe) % TUI_COLOR_PAIR_CACHE_SIZE];
+
+    if (slot->pair && slot->fg == color.fg && slot->bg == color.bg)
+    {
+      return slot->pair;
+    }
+
+    if (!slot->pair)
+    {
+      // Every ncurses pair is taken, fall back to the default
+      if (tui_color_pair_count + 1 >= COLOR_PAIRS)
+      {
+        return 0;
+      }
+
+      short pair = ++tui_color_pair_count;
+
+      // tui colors and ncurses colors differ by 1
+      init_pair(pair, color.fg - 1, color.bg - 1);
+
+      *slot = (tui_color_pair_t) { .fg = color.fg, .bg = color.bg, .pair = pair };
+
+      return pair;
+    }
+  }
+
+  // The cache is full of other combinations
+  return 0;
 }
 
 /*
@@ -401,11 +612,38 @@ static inline tui_color_t tui_color_inherit(tui_t* tui, tui_window_t* window, tu
 }
 
 /*
- * Turn on color of window
+ * Renderer attribute state
+ *
+ * Tracks which color pair is active in which window,
+ * so consecutive writes with the same color don't issue
+ * redundant attribute calls
+ */
+typedef struct tui_attr_state_t
+{
+  WINDOW* window;
+  short   pair;
+} tui_attr_state_t;
+
+static tui_attr_state_t tui_attr_state = { 0 };
+
+// Cells emitted during the current frame, copied into the stats
+static size_t tui_cell_counter = 0;
+
+/*
+ * Turn on color of window, if it is not already active
  */
 static inline void tui_ncurses_window_color_on(WINDOW* window, tui_color_t color)
 {
-  wattron(window, COLOR_PAIR(tui_color_index_get(color)));
+  short pair = tui_color_index_get(color);
+
+  if (tui_attr_state.window == window && tui_attr_state.pair == pair)
+  {
+    return;
+  }
+
+  wcolor_set(window, pair, NULL);
+
+  tui_attr_state = (tui_attr_state_t) { .window = window, .pair = pair };
 }
 
 /*
@@ -413,7 +651,9 @@ static inline void tui_ncurses_window_color_on(WINDOW* window, tui_color_t color
  */
 static inline void tui_ncurses_window_color_off(WINDOW* window, tui_color_t color)
 {
-  wattroff(window, COLOR_PAIR(tui_color_index_get(color)));
+  wcolor_set(window, 0, NULL);
+
+  tui_attr_state = (tui_attr_state_t) { .window = window, .pair = 0 };
 }
 
 /*
@@ -440,33 +680,92 @@ void tui_border_draw(tui_window_parent_t* window)
   }
 }
 
+static SCREEN* tui_headless_screen = NULL;
+
+static FILE*   tui_headless_tty    = NULL;
+
 /*
- * Initialize tui ncurses colors
+ * Open a headless curses screen over /dev/null
  *
- * ncurses color and index differ by 1
+ * tui_ncurses_init leaves an already opened screen in place,
+ * so the whole library runs without a tty - for benchmarks,
+ * CI runs and automated render tests
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to open screen
  */
-void tui_ncurses_colors_init(void)
+int tui_headless_open(void)
 {
-  for (short fg_index = 0; fg_index < 9; fg_index++)
-  {
-    for (short bg_index = 0; bg_index < 9; bg_index++)
-    {
-      size_t index = fg_index * 9 + bg_index;
+  if (tui_headless_screen) return 0;
 
-      short fg = (fg_index - 1);
-      short bg = (bg_index - 1);
+  FILE* tty = fopen("/dev/null", "r+");
 
-      init_pair(index, fg, bg);
-    }
+  if (!tty) return 1;
+
+  SCREEN* screen = newterm("xterm-256color", tty, tty);
+
+  if (!screen)
+  {
+    fclose(tty);
+
+    return 1;
   }
+
+  tui_headless_screen = screen;
+
+  tui_headless_tty = tty;
+
+  return 0;
+}
+
+/*
+ * Close the headless curses screen
+ */
+void tui_headless_close(void)
+{
+  if (!tui_headless_screen) return;
+
+  endwin();
+
+  delscreen(tui_headless_screen);
+
+  tui_headless_screen = NULL;
+
+  fclose(tui_headless_tty);
+
+  tui_headless_tty = NULL;
+}
+
+/*
+ * Read a rendered cell off the screen
+ *
+ * The physical screen image is kept in memory by curses,
+ * so rendered output can be asserted on without a tty
+ *
+ * RETURN (chtype cell)
+ * - the character with its attributes, mask with A_CHARTEXT
+ */
+chtype tui_headless_cell_get(int x, int y)
+{
+  return mvwinch(curscr, y, x);
 }
 
 /*
  * Initialize tui (ncurses)
+ *
+ * Color pairs are allocated lazily on first use,
+ * so startup initializes none of them
  */
 int tui_ncurses_init(void)
 {
-  initscr();
+  // A screen opened beforehand, like the headless one
+  // the benchmark uses, is left in place
+  if (!stdscr)
+  {
+    initscr();
+  }
+
   noecho();
   raw();
   keypad(stdscr, TRUE);
@@ -480,8 +779,6 @@ int tui_ncurses_init(void)
 
   use_default_colors();
 
-  tui_ncurses_colors_init();
-
   clear();
   refresh();
 
@@ -538,6 +835,9 @@ static inline WINDOW* tui_ncurses_window_resize(WINDOW* window, tui_rect_t rect)
 
   mvwin(window, rect.y, rect.x);
 
+  // The content has to be re-emitted at the new position
+  touchwin(window);
+
   return window;
 }
 
@@ -567,26 +867,313 @@ static inline void tui_ncurses_window_free(WINDOW** window)
 
   // wrefresh(*window);
 
+  // A new window could get the same address as this one
+  if (tui_attr_state.window == *window)
+  {
+    tui_attr_state.window = NULL;
+  }
+
   delwin(*window);
 
   *window = NULL;
 }
 
 /*
- * Fill ncurses WINDOW* with spaces
+ * Fill ncurses WINDOW* with spaces in specified color
+ *
+ * The blank row is built once and emitted with one call per row
  */
-static inline void tui_ncurses_window_fill(WINDOW* window)
+static inline void tui_ncurses_window_fill(WINDOW* window, tui_color_t color)
 {
   int w = getmaxx(window);
   int h = getmaxy(window);
 
+  chtype blank = (chtype) ' ' | COLOR_PAIR(tui_color_index_get(color));
+
+  chtype row[w];
+
+  for (int x = 0; x < w; x++)
+  {
+    row[x] = blank;
+  }
+
   for (int y = 0; y < h; y++)
   {
-    for (int x = 0; x < w; x++)
+    mvwaddchnstr(window, y, 0, row, w);
+  }
+
+  tui_cell_counter += (size_t) w * h;
+}
+
+/*
+ * Mark window as dirty, meaning it has to be redrawn
+ *
+ * The flag is propagated up to parents, so the
+ * render pass knows which subtrees to descend into
+ */
+void tui_window_dirty_set(tui_window_t* window)
+{
+  if (!window || window->_is_dirty) return;
+
+  window->_is_dirty = true;
+
+  if (window->tui)
+  {
+    window->tui->_is_dirty = true;
+  }
+
+  for (tui_window_parent_t* parent = window->parent; parent; parent = parent->head.parent)
+  {
+    if (parent->head._has_dirty) break;
+
+    parent->head._has_dirty = true;
+  }
+}
+
+/*
+ * Mark tui as dirty, forcing a full redraw of every window
+ */
+void tui_dirty_set(tui_t* tui)
+{
+  tui->_is_dirty = true;
+
+  tui->_is_full = true;
+}
+
+#define TUI_ARENA_BLOCK_SIZE 16384
+
+/*
+ * Allocate zeroed memory from the tui arena
+ *
+ * The memory lives until tui_delete frees the whole arena,
+ * so individual allocations are never freed
+ */
+static void* tui_arena_alloc(tui_t* tui, size_t size)
+{
+  // Keep every allocation aligned
+  size = (size + 15) & ~(size_t) 15;
+
+  tui_arena_block_t* block = tui->_arena;
+
+  if (!block || (block->used + size) > block->size)
+  {
+    size_t block_size = MAX(TUI_ARENA_BLOCK_SIZE, size);
+
+    block = malloc(sizeof(tui_arena_block_t) + block_size);
+
+    if (!block)
     {
-      mvwaddch(window, y, x, ' ');
+      return NULL;
     }
+
+    *block = (tui_arena_block_t)
+    {
+      .next = tui->_arena,
+      .size = block_size
+    };
+
+    tui->_arena = block;
   }
+
+  void* memory = block->data + block->used;
+
+  block->used += size;
+
+  memset(memory, 0, size);
+
+  tui->_stats.arena_bytes += size;
+
+  return memory;
+}
+
+void tui_wake(tui_t* tui);
+
+/*
+ * Worker thread routine, running jobs from the job queue
+ *
+ * Completed jobs are queued for the main loop,
+ * which is woken up through the wakeup pipe
+ */
+static void* tui_async_routine(void* arg)
+{
+  tui_t* tui = arg;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&tui->_async_mutex);
+
+    while (!tui->_async_jobs && !tui->_async_is_quitting)
+    {
+      pthread_cond_wait(&tui->_async_cond, &tui->_async_mutex);
+    }
+
+    if (!tui->_async_jobs)
+    {
+      pthread_mutex_unlock(&tui->_async_mutex);
+
+      break;
+    }
+
+    tui_async_t* job = tui->_async_jobs;
+
+    tui->_async_jobs = job->next;
+
+    pthread_mutex_unlock(&tui->_async_mutex);
+
+    if (job->work)
+    {
+      job->result = job->work(job->data);
+    }
+
+    pthread_mutex_lock(&tui->_async_mutex);
+
+    job->next = tui->_async_dones;
+
+    tui->_async_dones = job;
+
+    pthread_mutex_unlock(&tui->_async_mutex);
+
+    tui_wake(tui);
+  }
+
+  return NULL;
+}
+
+/*
+ * Submit async job to the worker pool
+ *
+ * The worker threads are spawned on the first submitted job
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to submit job
+ */
+int tui_async_submit(tui_t* tui, void* (*work) (void* data), void (*done) (tui_t* tui, void* data, void* result), void* data)
+{
+  tui_async_t* job = malloc(sizeof(tui_async_t));
+
+  if (!job)
+  {
+    return 1;
+  }
+
+  *job = (tui_async_t)
+  {
+    .work = work,
+    .done = done,
+    .data = data
+  };
+
+  pthread_mutex_lock(&tui->_async_mutex);
+
+  while (tui->_async_worker_count < TUI_ASYNC_WORKER_COUNT)
+  {
+    pthread_t* worker = &tui->_async_workers[tui->_async_worker_count];
+
+    if (pthread_create(worker, NULL, &tui_async_routine, tui) != 0)
+    {
+      break;
+    }
+
+    tui->_async_worker_count++;
+  }
+
+  if (tui->_async_worker_count == 0)
+  {
+    pthread_mutex_unlock(&tui->_async_mutex);
+
+    free(job);
+
+    return 1;
+  }
+
+  // Append job last, so jobs run in submit order
+  tui_async_t** tail = &tui->_async_jobs;
+
+  while (*tail)
+  {
+    tail = &(*tail)->next;
+  }
+
+  *tail = job;
+
+  pthread_cond_signal(&tui->_async_cond);
+
+  pthread_mutex_unlock(&tui->_async_mutex);
+
+  return 0;
+}
+
+/*
+ * Call done handlers of completed jobs on the main loop
+ */
+static inline void tui_async_drain(tui_t* tui)
+{
+  for (;;)
+  {
+    pthread_mutex_lock(&tui->_async_mutex);
+
+    tui_async_t* job = tui->_async_dones;
+
+    if (job)
+    {
+      tui->_async_dones = job->next;
+    }
+
+    pthread_mutex_unlock(&tui->_async_mutex);
+
+    if (!job) break;
+
+    if (job->done)
+    {
+      job->done(tui, job->data, job->result);
+    }
+
+    free(job);
+  }
+}
+
+/*
+ * Stop the worker pool and complete every remaining job
+ *
+ * Jobs that never ran get their done handler with a NULL
+ * result, so submitters can free the data they attached
+ */
+static inline void tui_async_quit(tui_t* tui)
+{
+  pthread_mutex_lock(&tui->_async_mutex);
+
+  tui->_async_is_quitting = true;
+
+  pthread_cond_broadcast(&tui->_async_cond);
+
+  pthread_mutex_unlock(&tui->_async_mutex);
+
+  for (size_t index = 0; index < tui->_async_worker_count; index++)
+  {
+    pthread_join(tui->_async_workers[index], NULL);
+  }
+
+  tui->_async_worker_count = 0;
+
+  for (tui_async_t* job = tui->_async_jobs; job;)
+  {
+    tui_async_t* next = job->next;
+
+    if (job->done)
+    {
+      job->done(tui, job->data, NULL);
+    }
+
+    free(job);
+
+    job = next;
+  }
+
+  tui->_async_jobs = NULL;
+
+  // Jobs the workers finished still deliver their result
+  tui_async_drain(tui);
 }
 
 /*
@@ -610,22 +1197,40 @@ tui_t* tui_create(tui_config_t config)
 
   tui_t* tui = malloc(sizeof(tui_t));
 
-  if (!tui)
+  if (!tui)
+  {
+    tui_ncurses_quit();
+
+    return NULL;
+  }
+
+  memset(tui, 0, sizeof(tui_t));
+
+  *tui = (tui_t)
+  {
+    .size.w    = getmaxx(stdscr),
+    .size.h    = getmaxy(stdscr),
+    .event     = config.event,
+    .color     = config.color,
+    ._is_dirty = true,
+    ._is_full  = true
+  };
+
+  if (pipe(tui->_wake_fds) == -1)
   {
+    free(tui);
+
     tui_ncurses_quit();
 
     return NULL;
   }
 
-  memset(tui, 0, sizeof(tui_t));
+  fcntl(tui->_wake_fds[0], F_SETFL, O_NONBLOCK);
+  fcntl(tui->_wake_fds[1], F_SETFL, O_NONBLOCK);
 
-  *tui = (tui_t)
-  {
-    .size.w = getmaxx(stdscr),
-    .size.h = getmaxy(stdscr),
-    .event  = config.event,
-    .color  = config.color
-  };
+  pthread_mutex_init(&tui->_async_mutex, NULL);
+
+  pthread_cond_init(&tui->_async_cond, NULL);
 
   if (tui->event.init)
   {
@@ -646,8 +1251,7 @@ static inline void tui_window_parent_free(tui_window_parent_t** window)
 
   tui_ncurses_window_free(&(*window)->head.window);
 
-  free(*window);
-
+  // The window struct itself lives in the arena
   *window = NULL;
 }
 
@@ -662,7 +1266,9 @@ static inline void tui_window_text_free(tui_window_text_t** window)
 
   free((*window)->text);
 
-  free(*window);
+  free((*window)->tokens);
+
+  free((*window)->line_ws);
 
   *window = NULL;
 }
@@ -676,7 +1282,7 @@ static inline void tui_window_grid_free(tui_window_grid_t** window)
 
   free((*window)->grid);
 
-  free(*window);
+  free((*window)->_shadow);
 
   *window = NULL;
 }
@@ -693,6 +1299,14 @@ static inline void tui_window_free(tui_window_t** window)
     (*window)->event.free(*window);
   }
 
+  (*window)->tui->_search_generation++;
+
+  // The parent has to redraw the area left by the window
+  if ((*window)->parent)
+  {
+    tui_window_dirty_set((tui_window_t*) (*window)->parent);
+  }
+
   switch ((*window)->type)
   {
     case TUI_WINDOW_PARENT:
@@ -751,6 +1365,9 @@ void tui_delete(tui_t** tui)
 {
   if (!tui || !(*tui)) return;
 
+  // Workers may still reference windows, so stop them first
+  tui_async_quit(*tui);
+
   for (size_t index = 0; index < (*tui)->menu_count; index++)
   {
     tui_menu_free(&(*tui)->menus[index]);
@@ -760,6 +1377,36 @@ void tui_delete(tui_t** tui)
 
   tui_windows_free(&(*tui)->windows, &(*tui)->window_count);
 
+  for (size_t index = 0; index < (*tui)->timer_count; index++)
+  {
+    free((*tui)->timers[index]);
+  }
+
+  free((*tui)->timers);
+
+  close((*tui)->_wake_fds[0]);
+  close((*tui)->_wake_fds[1]);
+
+  free((*tui)->_key_queue);
+
+  pthread_mutex_destroy(&(*tui)->_async_mutex);
+
+  pthread_cond_destroy(&(*tui)->_async_cond);
+
+  for (size_t index = 0; index < TUI_SEARCH_CACHE_SIZE; index++)
+  {
+    free((*tui)->_search_cache[index].search);
+  }
+
+  for (tui_arena_block_t* block = (*tui)->_arena; block;)
+  {
+    tui_arena_block_t* next = block->next;
+
+    free(block);
+
+    block = next;
+  }
+
   free(*tui);
 
   *tui = NULL;
@@ -806,27 +1453,53 @@ bool tui_event(tui_t* tui, int key)
 }
 
 /*
- * Get the height of wrapped text given the width
+ * Calculate wrapped line widths of text given the available width
+ *
+ * The wrap points are found in one pass over the text and the
+ * line index is cached on the window, reused across frames until
+ * the text or the available width changes
+ *
+ * RETURN (int line_count)
+ * - -1 | A word can not be wrapped inside the width
+ * -  0 | Text or width is empty
+ * - >0 | Number of wrapped lines
  */
-static inline int tui_text_h_get(char* text, int w)
+static inline int tui_text_lines_calc(tui_window_text_t* window, int w)
 {
-  size_t length = strlen(text);
+  // Reuse the cached line index when the inputs are unchanged
+  if (window->line_ws && window->line_w == w)
+  {
+    return window->line_count;
+  }
+
+  size_t length = window->text ? strlen(window->text) : 0;
 
-  if (length == 0 || w == 0)
+  if (length == 0 || w <= 0)
   {
     return 0;
   }
 
-  int h = 1;
+  // Worst case is one line per character
+  int* ws = realloc(window->line_ws, sizeof(int) * (length + 1));
+
+  if (!ws)
+  {
+    return -1;
+  }
+
+  window->line_ws = ws;
+  window->line_w  = w;
 
+  int h = 0;
   int x = 0;
+
   int space_index = 0;
 
   int last_space_index = space_index;
 
   for (size_t index = 0; index < length; index++)
   {
-    char letter = text[index];
+    char letter = window->text[index];
 
     if (letter == ' ')
     {
@@ -835,22 +1508,25 @@ static inline int tui_text_h_get(char* text, int w)
 
     if (letter == '\n')
     {
-      x = 0;
+      ws[h++] = x;
 
-      h++;
+      x = 0;
     }
     else if (x >= w)
     {
-      x = 0;
-
-      h++;
-
       // Current word cannot be wrapped
       if (space_index == last_space_index)
       {
+        window->line_count = -1;
+
         return -1;
       }
 
+      // Full line width - last partial word
+      ws[h++] = x - (index - space_index);
+
+      x = 0;
+
       index = space_index;
 
       last_space_index = space_index;
@@ -861,95 +1537,12 @@ static inline int tui_text_h_get(char* text, int w)
     }
   }
 
-  return h;
-}
-
-/*
- * Get the width of wrapped text given the height
- */
-static inline int tui_text_w_get(char* text, int h)
-{
-  int left  = 1;
-  int right = strlen(text);
-
-  int min_w = right;
-
-  // Try every value between left and right, inclusive left == right
-  while (left <= right)
-  {
-    int mid = (left + right) / 2;
-
-    int curr_h = tui_text_h_get(text, mid);
-
-    // If width was too small to wrap, increase width
-    if (curr_h == -1)
-    {
-      left = mid + 1;
-    }
-    // If height got to large, increase width
-    else if (curr_h > h)
-    {
-      left = mid + 1;
-    }
-    else // If the height is smaller than max height, store current best width
-    {
-      min_w = mid;
-      right = mid - 1;
-    }
-  }
-
-  return min_w;
-}
-
-/*
- * Get widths of lines in text, regarding height
- */
-static inline void tui_text_ws_get(int* ws, char* text, int h)
-{
-  int w = tui_text_w_get(text, h);
-
-  size_t length = strlen(text);
-
-  int y = 0;
-  int x = 0;
-
-  int space_index = 0;
-
-  for (size_t index = 0; (index < length) && (y < h); index++)
-  {
-    char letter = text[index];
-
-    if (letter == ' ')
-    {
-      space_index = index;
-    }
-
-    if (letter == '\n')
-    {
-      ws[y++] = x;
-
-      x = 0;
-    }
-    else if (x >= w)
-    {
-      // full line width - last partial word
-      ws[y++] = x - (index - space_index);
-
-      x = 0;
+  // Store the width of the last line
+  ws[h++] = x;
 
-      index = space_index;
-    }
-    else
-    {
-      x++;
-    }
+  window->line_count = h;
 
-    // Store the width of last line
-    if (index + 1 == length)
-    {
-      ws[y] = x;
-    }
-  }
+  return h;
 }
 
 /*
@@ -966,40 +1559,12 @@ static inline void tui_cursor_set(tui_t* tui, int x, int y)
 }
 
 /*
- * Extract ANSI code from string and increment index
- */
-static inline char* tui_string_ansi_extract(char* string, size_t length, size_t* index)
-{
-  char* ansi = malloc(sizeof(char) * (length - *index + 1));
-
-  if (!ansi)
-  {
-    return NULL;
-  }
-
-  size_t ansi_len = 0;
-
-  (*index) += 2;
-
-  while (*index < length && string[*index] != 'm')
-  {
-    ansi[ansi_len++] = string[(*index)++];
-  }
-
-  ansi[ansi_len] = '\0';
-
-  return ansi;
-}
-
-/*
- * Handle ANSI escape code
+ * Handle compiled ANSI code
  *
- * static tui_color_t color retains it's value between calls
+ * tui_color_t* color retains it's value between calls
  */
-static inline void tui_string_ansi_handle(tui_window_t* window, char* ansi, int x, int y, int x_shift, int y_shift, tui_color_t* color)
+static inline void tui_text_code_handle(tui_window_t* window, short code, int x, int y, int x_shift, int y_shift, tui_color_t* color)
 {
-  int code = atoi(ansi);
-
   // Reset everything
   if (code == 0)
   {
@@ -1007,6 +1572,9 @@ static inline void tui_string_ansi_handle(tui_window_t* window, char* ansi, int
 
     wattroff(window->window, A_ATTRIBUTES);
 
+    // The reset cleared the color pair behind the cache's back
+    tui_attr_state.window = NULL;
+
     tui_ncurses_window_color_on(window->window, window->_color);
   }
   // Cursor on
@@ -1043,7 +1611,7 @@ static inline void tui_text_render(tui_window_text_t* window)
 
   tui_rect_t rect = head->_rect;
 
-  int h = tui_text_h_get(window->text, rect.w);
+  int h = tui_text_lines_calc(window, rect.w);
 
   // If text can't be displayed, don't render
   if (h <= 0)
@@ -1051,9 +1619,7 @@ static inline void tui_text_render(tui_window_text_t* window)
     return;
   }
 
-  int ws[h];
-
-  tui_text_ws_get(ws, window->text, h);
+  int* ws = window->line_ws;
 
   // Store temporary color of letters
   tui_color_t color = head->_color;
@@ -1061,30 +1627,35 @@ static inline void tui_text_render(tui_window_text_t* window)
   int x = 0;
   int y = 0;
 
-  size_t length = strlen(window->string);
+  size_t length = strlen(window->text);
+
+  size_t token_index = 0;
 
   int y_shift = MAX(0, (float) window->pos / 2.f * (rect.h - h));
 
-  for (size_t index = 0; index < length; index++)
+  for (size_t index = 0; index <= length; index++)
   {
-    char letter = window->string[index];
-
     int w = ws[y];
 
     int x_shift = MAX(0, (float) window->align / 2.f * (rect.w - w));
 
-    if (letter == '\033')
+    // Apply the compiled ANSI codes at this position
+    while (token_index < window->token_count &&
+           window->tokens[token_index].index == index)
     {
-      char* ansi = tui_string_ansi_extract(window->string, length, &index);
+      tui_text_code_handle((tui_window_t*) window, window->tokens[token_index].code, x, y, x_shift, y_shift, &color);
 
-      if (ansi)
-      {
-        tui_string_ansi_handle((tui_window_t*) window, ansi, x, y, x_shift, y_shift, &color);
+      token_index++;
+    }
 
-        free(ansi);
-      }
+    if (index == length)
+    {
+      break;
     }
-    else if (x >= w)
+
+    char letter = window->text[index];
+
+    if (x >= w)
     {
       x = 0;
 
@@ -1108,35 +1679,61 @@ static inline void tui_text_render(tui_window_text_t* window)
 }
 
 /*
- * Extract just the text from string
+ * Compile string into extracted text and ANSI code tokens
  *
- * ANSI escape characters will be left out
+ * The escape sequences are parsed once here, so rendering
+ * and size calculation never have to scan them again
  */
-static inline char* tui_text_extract(char* string)
+static inline void tui_text_compile(tui_window_text_t* window)
 {
-  if (!string)
+  free(window->text);
+
+  free(window->tokens);
+
+  window->text        = NULL;
+  window->tokens      = NULL;
+  window->token_count = 0;
+
+  // The cached line index belongs to the old text
+  window->line_w     = 0;
+  window->line_count = 0;
+
+  if (!window->string)
   {
-    return NULL;
+    return;
   }
 
-  size_t length = strlen(string);
+  size_t length = strlen(window->string);
 
   char* text = malloc(sizeof(char) * (length + 1));
 
   if (!text)
   {
-    return NULL;
+    return;
   }
 
-  size_t text_len = 0;
+  // At most every third character starts an escape sequence
+  tui_text_token_t* tokens = malloc(sizeof(tui_text_token_t) * (length / 3 + 1));
+
+  size_t text_len    = 0;
+  size_t token_count = 0;
 
   for (size_t index = 0; index < length; index++)
   {
-    char letter = string[index];
+    char letter = window->string[index];
 
     if (letter == '\033')
     {
-      while (index < length && string[index] != 'm') index++;
+      if (tokens)
+      {
+        tokens[token_count++] = (tui_text_token_t)
+        {
+          .index = text_len,
+          .code  = atoi(window->string + index + 2)
+        };
+      }
+
+      while (index < length && window->string[index] != 'm') index++;
     }
     else
     {
@@ -1146,7 +1743,9 @@ static inline char* tui_text_extract(char* string)
 
   text[text_len] = '\0';
 
-  return text;
+  window->text        = text;
+  window->tokens      = tokens;
+  window->token_count = token_count;
 }
 
 /*
@@ -1166,7 +1765,7 @@ static inline void tui_window_text_render(tui_window_text_t* window)
 
   if (head->color.bg != TUI_COLOR_NONE)
   {
-    tui_ncurses_window_fill(head->window);
+    tui_ncurses_window_fill(head->window, head->_color);
   }
 
   // Draw text
@@ -1175,60 +1774,128 @@ static inline void tui_window_text_render(tui_window_text_t* window)
     tui_text_render(window);
   }
 
-  overwrite(head->window, parent);
+  wnoutrefresh(head->window);
+}
+
+/*
+ * Check if two grid squares are equal
+ */
+static inline bool tui_grid_square_equal(tui_window_grid_square_t a, tui_window_grid_square_t b)
+{
+  return (a.symbol   == b.symbol   &&
+          a.color.fg == b.color.fg &&
+          a.color.bg == b.color.bg);
 }
 
 /*
  * Render grid window
+ *
+ * The squares of the last render are kept in a shadow copy,
+ * so a clean composite only gets the changed spans emitted
+ *
+ * When the composite beneath was clobbered by an ancestor,
+ * is_forced is set and every square is emitted again
  */
-static inline void tui_window_grid_render(tui_window_grid_t* window)
+static inline void tui_window_grid_render(tui_window_grid_t* window, bool is_forced)
 {
   tui_window_t* head = &window->head;
 
   WINDOW* parent = head->parent ? head->parent->head.window : stdscr;
 
-  overwrite(parent, head->window);
-
   head->_color = tui_color_inherit(head->tui, (tui_window_t*) head->parent, head->color);
 
-  tui_ncurses_window_color_on(head->window, head->_color);
+  int square_count = window->_size.w * window->_size.h;
 
-  if (head->color.bg != TUI_COLOR_NONE)
+  if (!window->_shadow)
+  {
+    window->_shadow = malloc(sizeof(tui_window_grid_square_t) * square_count);
+
+    is_forced = true;
+  }
+
+  // Inherited colors change the look of every square
+  if (head->_color.fg != window->_shadow_color.fg ||
+      head->_color.bg != window->_shadow_color.bg)
+  {
+    is_forced = true;
+  }
+
+  if (is_forced)
   {
-    tui_ncurses_window_fill(head->window);
+    overwrite(parent, head->window);
+
+    tui_ncurses_window_color_on(head->window, head->_color);
+
+    if (head->color.bg != TUI_COLOR_NONE)
+    {
+      tui_ncurses_window_fill(head->window, head->_color);
+    }
   }
 
-  // Draw grid
+  // Draw grid, one batched write per changed span
   if (window->grid)
   {
     int x_shift = MAX(0, (head->_rect.w - window->_size.w) / 2.f);
     int y_shift = MAX(0, (head->_rect.h - window->_size.h) / 2.f);
 
+    chtype row[window->_size.w];
+
     for (int y = 0; y < window->_size.h; y++)
     {
-      for (int x = 0; x < window->_size.w; x++)
+      int span_start = -1;
+
+      for (int x = 0; x <= window->_size.w; x++)
       {
         int index = y * window->_size.w + x;
 
-        tui_window_grid_square_t square = window->grid[index];
+        bool is_changed = false;
+
+        if (x < window->_size.w)
+        {
+          tui_window_grid_square_t square = window->grid[index];
+
+          is_changed = is_forced || !window->_shadow ||
+            !tui_grid_square_equal(square, window->_shadow[index]);
+
+          if (is_changed)
+          {
+            char symbol = square.symbol ? square.symbol : ' ';
 
-        char symbol = square.symbol ? square.symbol : ' ';
+            tui_color_t color = tui_color_inherit(head->tui, (tui_window_t*) window, square.color);
 
-        tui_color_t color = tui_color_inherit(head->tui, (tui_window_t*) window, square.color);
+            row[x] = (chtype) symbol | COLOR_PAIR(tui_color_index_get(color));
 
-        tui_ncurses_window_color_on(head->window, color);
+            if (span_start == -1)
+            {
+              span_start = x;
+            }
+          }
+        }
+
+        // Emit the span of changed squares, once it ends
+        if (!is_changed && span_start != -1)
+        {
+          mvwaddchnstr(head->window, y_shift + y, x_shift + span_start, row + span_start, x - span_start);
 
-        mvwaddch(head->window, y_shift + y, x_shift + x, symbol);
+          tui_cell_counter += x - span_start;
 
-        tui_ncurses_window_color_off(head->window, color);
+          span_start = -1;
+        }
       }
     }
+
+    if (window->_shadow)
+    {
+      memcpy(window->_shadow, window->grid, sizeof(tui_window_grid_square_t) * square_count);
+
+      window->_shadow_color = head->_color;
+    }
   }
 
-  overwrite(head->window, parent);
+  wnoutrefresh(head->window);
 }
 
-static inline void tui_window_render(tui_window_t* window);
+static inline void tui_window_render(tui_window_t* window, bool is_forced);
 
 /*
  * Render parent window with all it's children
@@ -1241,46 +1908,80 @@ static inline void tui_window_parent_render(tui_window_parent_t* window)
 
   overwrite(parent, head->window);
 
+  // Re-emit the whole rect, repainting cells vacated by
+  // children that have moved or been hidden since last frame
+  touchwin(head->window);
+
   head->_color = tui_color_inherit(head->tui, (tui_window_t*) head->parent, head->color);
 
   tui_ncurses_window_color_on(head->window, head->_color);
 
   if (head->color.bg != TUI_COLOR_NONE)
   {
-    tui_ncurses_window_fill(head->window);
+    tui_ncurses_window_fill(head->window, head->_color);
   }
 
   // Draw border
   tui_border_draw(window);
 
-  // Render children
+  // The decoration goes beneath the children on the virtual screen
+  wnoutrefresh(head->window);
+
+  // Render children, whose on-screen cells were just clobbered
   for (size_t index = 0; index < window->child_count; index++)
   {
     tui_window_t* child = window->children[index];
 
     if (child->_is_visable)
     {
-      tui_window_render(child);
+      tui_window_render(child, true);
+    }
+  }
+}
+
+/*
+ * Render only the dirty children of a clean parent window
+ *
+ * The parent's decoration is untouched: its window buffer and
+ * its cells on the virtual screen are retained between frames
+ */
+static inline void tui_window_parent_dirty_render(tui_window_parent_t* window)
+{
+  for (size_t index = 0; index < window->child_count; index++)
+  {
+    tui_window_t* child = window->children[index];
+
+    if (child->_is_visable && (child->_is_dirty || child->_has_dirty))
+    {
+      tui_window_render(child, false);
     }
   }
-  
-  overwrite(head->window, parent);
 }
 
 /*
  * Render window
  */
-static inline void tui_window_render(tui_window_t* window)
+static inline void tui_window_render(tui_window_t* window, bool is_forced)
 {
   if (window->event.render)
   {
     window->event.render(window);
   }
 
+  window->tui->_stats.windows_rendered++;
+
   switch (window->type)
   {
     case TUI_WINDOW_PARENT:
-      tui_window_parent_render((tui_window_parent_t*) window);
+      // A clean parent only has to descend into it's dirty children
+      if (!is_forced && !window->_is_dirty && !window->tui->_is_full)
+      {
+        tui_window_parent_dirty_render((tui_window_parent_t*) window);
+      }
+      else
+      {
+        tui_window_parent_render((tui_window_parent_t*) window);
+      }
       break;
 
     case TUI_WINDOW_TEXT:
@@ -1288,16 +1989,21 @@ static inline void tui_window_render(tui_window_t* window)
       break;
 
     case TUI_WINDOW_GRID:
-      tui_window_grid_render((tui_window_grid_t*) window);
+      tui_window_grid_render((tui_window_grid_t*) window, is_forced || window->tui->_is_full);
       break;
 
     default:
       break;
   }
+
+  window->_is_dirty  = false;
+  window->_has_dirty = false;
 }
 
 /*
  * Render windows
+ *
+ * Clean windows are skipped, unless a full redraw is forced
  */
 static inline void tui_windows_render(tui_window_t** windows, size_t count)
 {
@@ -1305,9 +2011,10 @@ static inline void tui_windows_render(tui_window_t** windows, size_t count)
   {
     tui_window_t* window = windows[index];
 
-    if (window->_is_visable)
+    if (window->_is_visable &&
+        (window->tui->_is_full || window->_is_dirty || window->_has_dirty))
     {
-      tui_window_render(window);
+      tui_window_render(window, window->tui->_is_full);
     }
   }
 }
@@ -1317,17 +2024,13 @@ static inline void tui_windows_render(tui_window_t** windows, size_t count)
  *
  * Size is temporarily stored in _rect
  *
- * Also, extract text from string
+ * The text is already compiled from string when it was set
  */
 static inline void tui_window_text_size_calc(tui_window_text_t* window)
 {
   // Text window contains at least the cursor
   window->head._rect = (tui_rect_t) { .w = 1, .h = 1 };
 
-  free(window->text);
-
-  window->text = tui_text_extract(window->string);
-
   if (!window->text)
   {
     window->head._rect = TUI_RECT_NONE;
@@ -1342,9 +2045,14 @@ static inline void tui_window_text_size_calc(tui_window_text_t* window)
   }
   else if (window->text && strlen(window->text) > 0)
   {
-    int h = tui_text_h_get(window->text, window->head.tui->size.w);
+    int h = tui_text_lines_calc(window, window->head.tui->size.w);
+
+    int w = 0;
 
-    int w = tui_text_w_get(window->text, h);
+    for (int index = 0; index < h; index++)
+    {
+      w = MAX(w, window->line_ws[index]);
+    }
 
     window->head._rect = (tui_rect_t) { .w = w, .h = h};
   }
@@ -1488,9 +2196,20 @@ static inline void tui_window_parent_size_calc(tui_window_parent_t* parent)
  * Calculate preliminary size of window, based on content
  *
  * Size is temporarily stored in _rect
+ *
+ * If the window subtree is unchanged since the last frame,
+ * the memoized size is restored instead of recalculating
  */
 static inline void tui_window_size_calc(tui_window_t* window)
 {
+  if (window->_is_cached && !window->tui->_is_full &&
+      !window->_is_dirty && !window->_has_dirty)
+  {
+    window->_rect = window->_size_cache;
+
+    return;
+  }
+
   switch (window->type)
   {
     case TUI_WINDOW_PARENT:
@@ -1508,6 +2227,12 @@ static inline void tui_window_size_calc(tui_window_t* window)
     default:
       break;
   }
+
+  window->_size_cache = window->_rect;
+
+  window->_is_cached = true;
+
+  window->tui->_stats.layout_nodes++;
 }
 
 /*
@@ -1884,6 +2609,18 @@ static inline tui_rect_t tui_window_rect_get(tui_rect_t rect, int parent_w, int
   return rect;
 }
 
+/*
+ * Check if two rects are equal
+ */
+static inline bool tui_rect_equal(tui_rect_t first, tui_rect_t second)
+{
+  return (first.w == second.w &&
+          first.h == second.h &&
+          first.x == second.x &&
+          first.y == second.y &&
+          first.is_none == second.is_none);
+}
+
 /*
  * Hide window by setting _is_visable to false
  *
@@ -1895,6 +2632,15 @@ static inline void tui_window_set_invisable(tui_window_t* window)
   {
     window->_is_visable = false;
 
+    // A cached rect means the window still has cells on screen
+    if (!tui_rect_equal(window->_rect_cache, (tui_rect_t) { 0 }))
+    {
+      // The parent has to repaint the cells the window occupied
+      tui_window_dirty_set((tui_window_t*) window->parent);
+
+      window->_rect_cache = (tui_rect_t) { 0 };
+    }
+
     if (window->type == TUI_WINDOW_PARENT)
     {
       tui_window_parent_t* parent = (tui_window_parent_t*) window;
@@ -1909,6 +2655,28 @@ static inline void tui_window_set_invisable(tui_window_t* window)
   }
 }
 
+/*
+ * Restore the final rects of a skipped subtree
+ *
+ * The size phase stores preliminary sizes in _rect, so a
+ * subtree the rect phase skips has to get its descendants'
+ * final rects back from the cache before a forced render
+ */
+static inline void tui_window_rect_restore(tui_window_t* window)
+{
+  window->_rect = window->_rect_cache;
+
+  if (window->type == TUI_WINDOW_PARENT)
+  {
+    tui_window_parent_t* parent = (tui_window_parent_t*) window;
+
+    for (size_t index = 0; index < parent->child_count; index++)
+    {
+      tui_window_rect_restore(parent->children[index]);
+    }
+  }
+}
+
 /*
  * Get maximum content size of parent
  */
@@ -1955,14 +2723,21 @@ static inline void tui_children_rect_calc(tui_window_parent_t* parent)
 
     if (!child->rect.is_none)
     {
-      child->_is_visable = !child->is_hidden;
+      if (child->is_hidden)
+      {
+        tui_window_set_invisable(child);
+      }
+      else
+      {
+        child->_is_visable = true;
+      }
 
       continue;
     }
 
     if (child->is_hidden)
     {
-      child->_is_visable = false;
+      tui_window_set_invisable(child);
     }
     else if (parent->is_vertical)
     {
@@ -1970,7 +2745,7 @@ static inline void tui_children_rect_calc(tui_window_parent_t* parent)
          (align_size.h + child->_rect.h > max_size.h ||
           child->_rect.w > max_size.w))
       {
-        child->_is_visable = false;
+        tui_window_set_invisable(child);
 
         continue;
       }
@@ -1994,7 +2769,7 @@ static inline void tui_children_rect_calc(tui_window_parent_t* parent)
          (align_size.w + child->_rect.w > max_size.w ||
           child->_rect.h > max_size.h))
       {
-        child->_is_visable = false;
+        tui_window_set_invisable(child);
 
         continue;
       }
@@ -2057,7 +2832,39 @@ static inline void tui_children_rect_calc(tui_window_parent_t* parent)
       child->_rect.x += parent->head._rect.x;
       child->_rect.y += parent->head._rect.y;
 
-      child->window = tui_ncurses_window_update(child->window, child->_rect);
+      bool is_moved = !tui_rect_equal(child->_rect, child->_rect_cache);
+
+      // If the rect is unchanged and the subtree is clean,
+      // the curses windows are still valid, even during a full
+      // redraw - but the size phase has clobbered the subtree's
+      // rects, so they are restored before the forced render
+      if (!is_moved && child->window &&
+          !child->_is_dirty && !child->_has_dirty)
+      {
+        if (child->tui->_is_full)
+        {
+          tui_window_rect_restore(child);
+        }
+
+        continue;
+      }
+
+      child->_rect_cache = child->_rect;
+
+      // Only a moved or missing curses window needs updating
+      if (is_moved || !child->window)
+      {
+        child->window = tui_ncurses_window_update(child->window, child->_rect);
+      }
+
+      if (is_moved)
+      {
+        // The moved child has to be redrawn in place, and the
+        // parent has to repaint the cells it vacated
+        tui_window_dirty_set(child);
+
+        tui_window_dirty_set((tui_window_t*) parent);
+      }
 
       if (child->type == TUI_WINDOW_PARENT)
       {
@@ -2095,7 +2902,39 @@ static inline void tui_window_rect_calc(tui_window_t* window, int w, int h)
   {
     window->_is_visable = true;
 
-    window->window = tui_ncurses_window_update(window->window, window->_rect);
+    bool is_moved = !tui_rect_equal(window->_rect, window->_rect_cache);
+
+    // If the rect is unchanged and the subtree is clean,
+    // the curses windows are still valid, even during a full
+    // redraw - but the size phase has clobbered the subtree's
+    // rects, so they are restored before the forced render
+    if (!is_moved && window->window &&
+        !window->_is_dirty && !window->_has_dirty)
+    {
+      if (window->tui->_is_full)
+      {
+        tui_window_rect_restore(window);
+      }
+
+      return;
+    }
+
+    window->_rect_cache = window->_rect;
+
+    // Only a moved or missing curses window needs updating
+    if (is_moved || !window->window)
+    {
+      window->window = tui_ncurses_window_update(window->window, window->_rect);
+    }
+
+    if (is_moved)
+    {
+      // The moved window has to be redrawn in place, and its
+      // parent has to repaint the cells it vacated
+      tui_window_dirty_set(window);
+
+      tui_window_dirty_set((tui_window_t*) window->parent);
+    }
 
     if(window->type == TUI_WINDOW_PARENT)
     {
@@ -2150,17 +2989,46 @@ static inline void tui_size_calc(tui_t* tui)
   }
 }
 
+/*
+ * Get current monotonic time in microseconds
+ */
+static inline long tui_time_us_get(void)
+{
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return time.tv_sec * 1000000 + time.tv_nsec / 1000;
+}
+
 /*
  * Resize tui by recalculating every size and rect of windows
  */
 static inline void tui_resize(tui_t* tui)
 {
-  tui->size.w = getmaxx(stdscr);
-  tui->size.h = getmaxy(stdscr);
+  int w = getmaxx(stdscr);
+  int h = getmaxy(stdscr);
+
+  // A new terminal size invalidates every window
+  if (w != tui->size.w || h != tui->size.h)
+  {
+    tui_dirty_set(tui);
+  }
+
+  tui->size.w = w;
+  tui->size.h = h;
+
+  long start_us = tui_time_us_get();
 
   tui_size_calc(tui);
 
+  long size_us = tui_time_us_get();
+
   tui_rect_calc(tui);
+
+  tui->_stats.size_calc_us = size_us - start_us;
+
+  tui->_stats.rect_calc_us = tui_time_us_get() - size_us;
 }
 
 /*
@@ -2201,33 +3069,83 @@ static inline void tui_update(tui_t* tui)
   }
 }
 
+/*
+ * Draw the stats overlay on top of everything
+ */
+static inline void tui_stats_draw(tui_t* tui)
+{
+  tui_stats_t stats = tui->_stats;
+
+  char buffer[128];
+
+  int length = snprintf(buffer, sizeof(buffer),
+    " %ldus (avg %ldus) upd %ld sz %ld rc %ld rd %ld | win %zu cell %zu node %zu ",
+    stats.frame_us, stats.frame_avg_us, stats.update_us,
+    stats.size_calc_us, stats.rect_calc_us, stats.render_us,
+    stats.windows_rendered, stats.cells_written, stats.layout_nodes);
+
+  mvwaddnstr(stdscr, 0, 0, buffer, MIN(length, tui->size.w));
+}
+
+/*
+ * Get a copy of the frame statistics
+ */
+tui_stats_t tui_stats_get(tui_t* tui)
+{
+  return tui->_stats;
+}
+
 /*
  * Render tui - active menu and all windows
  */
 void tui_render(tui_t* tui)
 {
-  tui->cursor.is_active = false;
-
-  curs_set(0);
+  long start_us = tui_time_us_get();
 
   tui_update(tui);
 
+  long update_us = tui_time_us_get() - start_us;
+
+  // If no window has changed, the last frame is still valid
+  if (!tui->_is_dirty)
+  {
+    return;
+  }
+
+  tui->_stats.update_us = update_us;
+
+  tui->_stats.windows_rendered = 0;
+
+  tui->_stats.layout_nodes = 0;
+
+  tui_cell_counter = 0;
+
+  curs_set(0);
+
   tui_resize(tui);
 
+  long render_start_us = tui_time_us_get();
+
   tui_menu_t* menu = tui->menu;
 
+  tui_color_t back_color = tui->color;
+
   if (menu)
   {
     menu->_color = tui_color_inherit(menu->tui, NULL, menu->color);
 
-    tui_ncurses_window_color_on(stdscr, menu->_color);
+    back_color = menu->_color;
   }
-  else
+
+  tui_ncurses_window_color_on(stdscr, back_color);
+
+  if (tui->_is_full)
   {
-    tui_ncurses_window_color_on(stdscr, tui->color);
-  }
+    tui_ncurses_window_fill(stdscr, back_color);
 
-  tui_ncurses_window_fill(stdscr);
+    // The background goes beneath every window on the virtual screen
+    wnoutrefresh(stdscr);
+  }
 
   // 3. Render tui windows
   tui_windows_render(tui->windows, tui->window_count);
@@ -2238,6 +3156,17 @@ void tui_render(tui_t* tui)
     tui_windows_render(menu->windows, menu->window_count);
   }
 
+  if (tui->is_stats_shown)
+  {
+    tui_stats_draw(tui);
+
+    // Only the touched overlay line is copied over the windows
+    wnoutrefresh(stdscr);
+  }
+
+  // Flush every marked window to the screen in one update
+  doupdate();
+
   tui_cursor_t cursor = tui->cursor;
 
   if (cursor.is_active)
@@ -2245,11 +3174,27 @@ void tui_render(tui_t* tui)
     if (cursor.y >= 0 && cursor.y < tui->size.h &&
         cursor.x >= 0 && cursor.x < tui->size.w)
     {
-      move(cursor.y, cursor.x);
+      // Place the terminal cursor without repainting anything
+      mvcur(-1, -1, cursor.y, cursor.x);
 
       curs_set(1);
     }
   }
+
+  tui->_stats.render_us = tui_time_us_get() - render_start_us;
+
+  tui->_stats.cells_written = tui_cell_counter;
+
+  tui->_stats.frame_us = tui_time_us_get() - start_us;
+
+  // Rolling average over roughly the last 16 frames
+  tui->_stats.frame_avg_us += (tui->_stats.frame_us - tui->_stats.frame_avg_us) / 16;
+
+  tui->_stats.frame_count++;
+
+  tui->_is_dirty = false;
+
+  tui->_is_full = false;
 }
 
 /*
@@ -2281,15 +3226,13 @@ typedef struct tui_window_parent_config_t
  */
 static inline tui_window_parent_t* _tui_window_parent_create(tui_t* tui, tui_window_parent_config_t config)
 {
-  tui_window_parent_t* window = malloc(sizeof(tui_window_parent_t));
+  tui_window_parent_t* window = tui_arena_alloc(tui, sizeof(tui_window_parent_t));
 
   if (!window)
   {
     return NULL;
   }
 
-  memset(window, 0, sizeof(tui_window_parent_t));
-
   tui_window_t head = (tui_window_t)
   {
     .type        = TUI_WINDOW_PARENT,
@@ -2329,6 +3272,12 @@ void tui_window_text_string_set(tui_window_text_t* window, char* string)
 {
   if (window && string)
   {
+    // If the string is unchanged, the window is still clean
+    if (window->string && strcmp(window->string, string) == 0)
+    {
+      return;
+    }
+
     size_t length = strlen(string);
 
     if (length >= window->string_size)
@@ -2339,14 +3288,97 @@ void tui_window_text_string_set(tui_window_text_t* window, char* string)
 
       window->string_size = length + 1;
     }
-    
+
     if (window->string)
     {
       strcpy(window->string, string);
 
       window->string[length] = '\0';
     }
+
+    tui_text_compile(window);
+
+    tui_window_dirty_set((tui_window_t*) window);
+  }
+}
+
+/*
+ * Format string straight into text window's retained buffer
+ *
+ * The buffer grows geometricly and never shrinks, and the
+ * window stays clean when the produced string is identical
+ * to the current one - a label that didn't change is free
+ */
+void tui_window_text_string_printf(tui_window_text_t* window, const char* format, ...)
+{
+  if (!window || !format) return;
+
+  va_list args;
+
+  va_start(args, format);
+
+  va_list args_copy;
+
+  va_copy(args_copy, args);
+
+  int length = vsnprintf(NULL, 0, format, args);
+
+  va_end(args);
+
+  if (length < 0)
+  {
+    va_end(args_copy);
+
+    return;
+  }
+
+  size_t old_length = window->string ? strlen(window->string) : 0;
+
+  // Only a string of the same length can be identical
+  if (window->string && (size_t) length == old_length)
+  {
+    char produced[length + 1];
+
+    vsnprintf(produced, length + 1, format, args_copy);
+
+    va_end(args_copy);
+
+    if (strcmp(window->string, produced) == 0)
+    {
+      return;
+    }
+
+    memcpy(window->string, produced, length + 1);
+  }
+  else
+  {
+    if ((size_t) length >= window->string_size)
+    {
+      size_t new_size = window->string_size ? window->string_size : 16;
+
+      while (new_size <= (size_t) length)
+      {
+        new_size *= 2;
+      }
+
+      free(window->string);
+
+      window->string = malloc(sizeof(char) * new_size);
+
+      window->string_size = new_size;
+    }
+
+    if (window->string)
+    {
+      vsnprintf(window->string, length + 1, format, args_copy);
+    }
+
+    va_end(args_copy);
   }
+
+  tui_text_compile(window);
+
+  tui_window_dirty_set((tui_window_t*) window);
 }
 
 /*
@@ -2376,15 +3408,13 @@ typedef struct tui_window_text_config_t
  */
 static inline tui_window_text_t* _tui_window_text_create(tui_t* tui, tui_window_text_config_t config)
 {
-  tui_window_text_t* window = malloc(sizeof(tui_window_text_t));
+  tui_window_text_t* window = tui_arena_alloc(tui, sizeof(tui_window_text_t));
 
   if (!window)
   {
     return NULL;
   }
 
-  memset(window, 0, sizeof(tui_window_text_t));
-
   tui_window_t head = (tui_window_t)
   {
     .type        = TUI_WINDOW_TEXT,
@@ -2439,6 +3469,10 @@ typedef struct tui_window_grid_config_t
 
 /*
  * Resize grid and store size in _size
+ *
+ * The squares overlapping the old and new geometry are
+ * preserved by remapping the rows in place, and the storage
+ * is grow-only - it only reallocates past its capacity
  */
 int tui_window_grid_resize(tui_window_grid_t* window, tui_size_t size)
 {
@@ -2447,23 +3481,75 @@ int tui_window_grid_resize(tui_window_grid_t* window, tui_size_t size)
     return 1;
   }
 
-  free(window->grid);
+  tui_size_t old_size = window->_size;
+
+  if (window->grid && size.w == old_size.w && size.h == old_size.h)
+  {
+    return 0;
+  }
+
+  size_t square_count = (size_t) size.w * size.h;
+
+  if (square_count > window->_grid_capacity)
+  {
+    size_t capacity = window->_grid_capacity ? window->_grid_capacity : 64;
+
+    while (capacity < square_count)
+    {
+      capacity *= 2;
+    }
+
+    tui_window_grid_square_t* grid = realloc(window->grid, sizeof(tui_window_grid_square_t) * capacity);
+
+    if (!grid)
+    {
+      return 2;
+    }
+
+    window->grid = grid;
 
-  int square_count = size.w * size.h;
+    window->_grid_capacity = capacity;
+  }
+
+  tui_window_grid_square_t* grid = window->grid;
 
-  tui_window_grid_square_t* grid = malloc(sizeof(tui_window_grid_square_t) * square_count);
+  int copy_w = MIN(size.w, old_size.w);
+  int copy_h = MIN(size.h, old_size.h);
 
-  if (!grid)
+  if (copy_h > 0 && size.w < old_size.w)
   {
-    return 2;
+    // Rows shrink, compact them forward
+    for (int y = 1; y < copy_h; y++)
+    {
+      memmove(grid + y * size.w, grid + y * old_size.w, sizeof(tui_window_grid_square_t) * copy_w);
+    }
   }
+  else if (copy_h > 0 && size.w > old_size.w)
+  {
+    // Rows grow, spread them backward and clear the new columns
+    for (int y = copy_h; y-- > 0;)
+    {
+      memmove(grid + y * size.w, grid + y * old_size.w, sizeof(tui_window_grid_square_t) * copy_w);
 
-  memset(grid, 0, sizeof(tui_window_grid_square_t) * square_count);
+      memset(grid + y * size.w + copy_w, 0, sizeof(tui_window_grid_square_t) * (size.w - copy_w));
+    }
+  }
 
-  window->grid = grid;
+  // Clear the rows below the preserved content
+  if (size.h > copy_h)
+  {
+    memset(grid + copy_h * size.w, 0, sizeof(tui_window_grid_square_t) * (size.h - copy_h) * size.w);
+  }
 
   window->_size = size;
 
+  // The shadow no longer matches the grid
+  free(window->_shadow);
+
+  window->_shadow = NULL;
+
+  tui_window_dirty_set((tui_window_t*) window);
+
   return 0;
 }
 
@@ -2472,15 +3558,13 @@ int tui_window_grid_resize(tui_window_grid_t* window, tui_size_t size)
  */
 static inline tui_window_grid_t* _tui_window_grid_create(tui_t* tui, tui_window_grid_config_t config)
 {
-  tui_window_grid_t* window = malloc(sizeof(tui_window_grid_t));
+  tui_window_grid_t* window = tui_arena_alloc(tui, sizeof(tui_window_grid_t));
 
   if (!window)
   {
     return NULL;
   }
 
-  memset(window, 0, sizeof(tui_window_grid_t));
-
   tui_window_t head = (tui_window_t)
   {
     .type        = TUI_WINDOW_GRID,
@@ -2507,8 +3591,6 @@ static inline tui_window_grid_t* _tui_window_grid_create(tui_t* tui, tui_window_
 
   if (tui_window_grid_resize(window, config.size) != 0)
   {
-    free(window);
-
     return NULL;
   }
 
@@ -2520,19 +3602,30 @@ static inline tui_window_grid_t* _tui_window_grid_create(tui_t* tui, tui_window_
  */
 static inline int tui_windows_window_append(tui_window_t*** windows, size_t* count, tui_window_t* window)
 {
-  tui_window_t** temp_windows = realloc(*windows, sizeof(tui_window_t*) * (*count + 1));
-
-  if (!temp_windows)
+  // Double the array when count reaches a power of two,
+  // so appends copy amortized O(1) instead of every time
+  if ((*count & (*count - 1)) == 0)
   {
-    return 1;
-  }
+    size_t capacity = MAX(*count * 2, 1);
+
+    tui_window_t** temp_windows = realloc(*windows, sizeof(tui_window_t*) * capacity);
+
+    if (!temp_windows)
+    {
+      return 1;
+    }
 
-  *windows = temp_windows;
+    *windows = temp_windows;
+  }
 
   (*windows)[*count] = window;
 
   (*count)++;
 
+  window->tui->_search_generation++;
+
+  tui_window_dirty_set(window);
+
   return 0;
 }
 
@@ -2834,6 +3927,8 @@ void tui_window_grid_square_set(tui_window_grid_t* window, int x, int y, tui_win
   if (old_square)
   {
     *old_square = square;
+
+    tui_window_dirty_set((tui_window_t*) window);
   }
 }
 
@@ -2860,6 +3955,8 @@ void tui_window_grid_square_modify(tui_window_grid_t* window, int x, int y, tui_
     {
       old_square->symbol = square.symbol;
     }
+
+    tui_window_dirty_set((tui_window_t*) window);
   }
 }
 
@@ -2867,12 +3964,15 @@ void tui_window_grid_square_modify(tui_window_grid_t* window, int x, int y, tui_
  * Update visable string from input buffer
  *
  * The buffer can for example be partially visable
+ *
+ * The text before the cursor sits in front of the gap,
+ * and the text after the cursor sits behind it
  */
 static inline void tui_input_string_update(tui_input_t* input)
 {
   size_t string_len = 0;
 
-  for (size_t index = input->scroll; index < input->cursor; index++)
+  for (size_t index = input->scroll; index < input->_gap_start; index++)
   {
     input->string[string_len++] = input->buffer[index];
   }
@@ -2881,7 +3981,7 @@ static inline void tui_input_string_update(tui_input_t* input)
 
   string_len += 4;
 
-  for (size_t index = input->cursor; index < input->buffer_len; index++)
+  for (size_t index = input->_gap_end; index < input->buffer_size; index++)
   {
     input->string[string_len++] = input->buffer[index];
   }
@@ -2891,7 +3991,7 @@ static inline void tui_input_string_update(tui_input_t* input)
   // If the cursor is at the end of the string,
   // and input text window is the active window,
   // add space for cursor
-  if (input->cursor == input->buffer_len &&
+  if (input->_gap_end == input->buffer_size &&
       window && (tui_window_t*) input->window == window)
   {
     input->string[string_len++] = ' ';
@@ -2900,6 +4000,49 @@ static inline void tui_input_string_update(tui_input_t* input)
   input->string[string_len] = '\0';
 }
 
+/*
+ * Get visable string of input, regenerating it if needed
+ *
+ * Mutations just mark the string dirty, so a burst of
+ * keystrokes costs one regeneration at render time
+ */
+char* tui_input_string_get(tui_input_t* input)
+{
+  if (input->_is_dirty)
+  {
+    tui_input_string_update(input);
+
+    input->_is_dirty = false;
+  }
+
+  return input->string;
+}
+
+/*
+ * Get text of input as a contiguous NUL terminated string
+ *
+ * The text is copied out of the gap buffer,
+ * and is valid until the next input mutation
+ */
+char* tui_input_buffer_get(tui_input_t* input)
+{
+  size_t length = 0;
+
+  for (size_t index = 0; index < input->_gap_start; index++)
+  {
+    input->_text[length++] = input->buffer[index];
+  }
+
+  for (size_t index = input->_gap_end; index < input->buffer_size; index++)
+  {
+    input->_text[length++] = input->buffer[index];
+  }
+
+  input->_text[length] = '\0';
+
+  return input->_text;
+}
+
 /*
  * Create input struct
  */
@@ -2921,6 +4064,9 @@ tui_input_t* tui_input_create(tui_t* tui, size_t size, tui_window_text_t* window
     .window      = window,
   };
 
+  // The gap starts out covering the whole buffer
+  input->_gap_end = size;
+
 
   input->buffer = malloc(sizeof(char) * (size + 1));
 
@@ -2945,6 +4091,20 @@ tui_input_t* tui_input_create(tui_t* tui, size_t size, tui_window_text_t* window
     return NULL;
   }
 
+
+  input->_text = malloc(sizeof(char) * (size + 1));
+
+  if (!input->_text)
+  {
+    free(input->string);
+
+    free(input->buffer);
+
+    free(input);
+
+    return NULL;
+  }
+
   tui_input_string_update(input);
 
   return input;
@@ -2961,6 +4121,8 @@ void tui_input_delete(tui_input_t** input)
 
   free((*input)->string);
 
+  free((*input)->_text);
+
   free(*input);
 
   *input = NULL;
@@ -2968,10 +4130,14 @@ void tui_input_delete(tui_input_t** input)
 
 /*
  * Add symbol to input buffer
+ *
+ * The symbol drops straight into the gap,
+ * no matter how long the text is
  */
 static inline bool tui_input_symbol_add(tui_input_t* input, int key)
 {
-  if (input->buffer_len >= input->buffer_size)
+  // A closed gap means the buffer is full
+  if (input->_gap_start >= input->_gap_end)
   {
     return false;
   }
@@ -2981,66 +4147,41 @@ static inline bool tui_input_symbol_add(tui_input_t* input, int key)
     return false;
   }
 
-  char symbol = key;
-
-  // Shift characters forward to make room for new character
-  for (size_t index = input->buffer_len + 1; index-- > (input->cursor + 1);)
-  {
-    input->buffer[index] = input->buffer[index - 1];
-  }
-
-  input->buffer[input->cursor] = symbol;
-
-  input->buffer_len++;
-
-
-  if (input->cursor < input->buffer_len)
-  {
-    input->cursor++;
-  }
-
-  // The cursor is at the end of the input window
-  /*
-  if((win->cursor - win->scroll) >= (win->head.w - 2))
-  {
-    win->scroll++; // Scroll one more character
-  }
-  */
+  input->buffer[input->_gap_start++] = key;
 
-  tui_input_string_update(input);
+  input->_is_dirty = true;
 
   return true;
 }
 
 /*
  * Delete symbol from input buffer
+ *
+ * The gap just swallows the symbol before the cursor
  */
 static inline bool tui_input_symbol_del(tui_input_t* input)
 {
-  if (input->cursor <= 0 || input->buffer_len <= 0)
+  if (input->_gap_start == 0)
   {
     return false;
   }
 
-  // Fill in the room left by the deleted character
-  for (size_t index = input->cursor - 1; index < input->buffer_len; index++)
+  input->_gap_start--;
+
+  if (input->_gap_start < input->scroll)
   {
-    input->buffer[index] = input->buffer[index + 1];
+    input->scroll = input->_gap_start;
   }
 
-  input->buffer_len--;
-
-  input->buffer[input->buffer_len] = '\0';
-
-  input->cursor = MIN(input->cursor - 1, input->buffer_len);
-
-  tui_input_string_update(input);
+  input->_is_dirty = true;
 
   return true;
 }
 
 /*
  * Scroll right in input buffer
+ *
+ * The symbol after the gap moves in front of it
  */
 static inline bool tui_input_scroll_right(tui_input_t* input)
 {
@@ -3051,20 +4192,22 @@ static inline bool tui_input_scroll_right(tui_input_t* input)
   }
 
   // The cursor can not be further than the text itself
-  if (input->cursor >= input->buffer_len)
+  if (input->_gap_end >= input->buffer_size)
   {
     return false;
   }
 
-  input->cursor++;
+  input->buffer[input->_gap_start++] = input->buffer[input->_gap_end++];
 
-  tui_input_string_update(input);
+  input->_is_dirty = true;
 
   return true;
 }
 
 /*
  * Scroll left in input buffer
+ *
+ * The symbol before the gap moves behind it
  */
 static inline bool tui_input_scroll_left(tui_input_t* input)
 {
@@ -3075,21 +4218,21 @@ static inline bool tui_input_scroll_left(tui_input_t* input)
   }
 
   // Can't scroll past the beginning
-  if (input->cursor == 0)
+  if (input->_gap_start == 0)
   {
     return false;
   }
 
-  input->cursor--;
+  input->buffer[--input->_gap_end] = input->buffer[--input->_gap_start];
 
   // If the cursor is to the left of the window,
   // scroll to the start of the cursor
-  if (input->cursor < input->scroll)
+  if (input->_gap_start < input->scroll)
   {
-    input->scroll = input->cursor;
+    input->scroll = input->_gap_start;
   }
 
-  tui_input_string_update(input);
+  input->_is_dirty = true;
 
   return true;
 }
@@ -3122,20 +4265,47 @@ bool tui_input_event(tui_input_t* input, int key)
  */
 int tui_list_item_add(tui_list_t* list, tui_window_t* item)
 {
-  tui_window_t** temp_items = realloc(list->items, sizeof(tui_window_t*) * (list->item_count + 1));
-
-  if (!temp_items)
+  if ((list->item_count & (list->item_count - 1)) == 0)
   {
-    return 1;
-  }
+    size_t capacity = MAX(list->item_count * 2, 1);
+
+    tui_window_t** temp_items = realloc(list->items, sizeof(tui_window_t*) * capacity);
+
+    if (!temp_items)
+    {
+      return 1;
+    }
 
-  list->items = temp_items;
+    list->items = temp_items;
+  }
 
   list->items[list->item_count++] = item;
 
   return 0;
 }
 
+/*
+ * Keep the virtual selection in sync with the pooled one
+ *
+ * data_index mirrors _data_first + item_index in virtual mode,
+ * so moving the pooled selection has to move the data one too
+ */
+static inline void tui_list_select_sync(tui_list_t* list)
+{
+  if (!list->bind || list->data_count == 0) return;
+
+  size_t data_index = list->_data_first + list->item_index;
+
+  if (data_index >= list->data_count)
+  {
+    data_index = list->data_count - 1;
+
+    list->item_index = data_index - list->_data_first;
+  }
+
+  list->data_index = data_index;
+}
+
 /*
  * Update list item by changing to another if it is invisable
  *
@@ -3155,6 +4325,8 @@ bool tui_list_item_update(tui_list_t* list)
       {
         list->item_index = index;
 
+        tui_list_select_sync(list);
+
         return true;
       }
     }
@@ -3167,6 +4339,8 @@ bool tui_list_item_update(tui_list_t* list)
       {
         list->item_index = index;
 
+        tui_list_select_sync(list);
+
         return true;
       }
     }
@@ -3212,11 +4386,95 @@ void tui_list_delete(tui_list_t** list)
   *list = NULL;
 }
 
+/*
+ * Bind the pooled item windows to their data items
+ */
+static inline void tui_list_rebind(tui_list_t* list)
+{
+  if (!list->bind) return;
+
+  for (size_t index = 0; index < list->item_count; index++)
+  {
+    size_t data_index = list->_data_first + index;
+
+    if (data_index >= list->data_count) break;
+
+    list->bind(list, list->items[index], data_index);
+  }
+}
+
+/*
+ * Turn the list virtual over data_count items
+ *
+ * The already added item windows become the recycled pool,
+ * so layout and memory stay constant however large the data is
+ */
+void tui_list_virtual_set(tui_list_t* list, size_t data_count, void (*bind) (tui_list_t* list, tui_window_t* item, size_t data_index))
+{
+  list->bind = bind;
+
+  list->data_count = data_count;
+
+  list->data_index = 0;
+
+  list->_data_first = 0;
+
+  tui_list_rebind(list);
+}
+
+/*
+ * Rebind a data item, if it is bound to a pooled window
+ *
+ * Call this when the data behind the item has changed
+ */
+void tui_list_data_update(tui_list_t* list, size_t data_index)
+{
+  if (!list->bind) return;
+
+  if (data_index < list->_data_first ||
+      data_index >= list->_data_first + list->item_count)
+  {
+    return;
+  }
+
+  list->bind(list, list->items[data_index - list->_data_first], data_index);
+}
+
 /*
  * Scroll forward to next selected item
+ *
+ * A virtual list shifts its bound range instead,
+ * once the selection reaches the end of the pool
  */
 static inline bool tui_list_scroll_forward(tui_list_t* list)
 {
+  if (list->bind)
+  {
+    if (list->data_index + 1 >= list->data_count)
+    {
+      return false;
+    }
+
+    list->data_index++;
+
+    size_t next_index = list->item_index + 1;
+
+    if (next_index < list->item_count &&
+        next_index < list->data_count - list->_data_first &&
+        list->items[next_index]->_is_visable)
+    {
+      list->item_index = next_index;
+    }
+    else
+    {
+      list->_data_first++;
+
+      tui_list_rebind(list);
+    }
+
+    return true;
+  }
+
   for (size_t index = list->item_index + 1; index < list->item_count; index++)
   {
     tui_window_t* window = list->items[index];
@@ -3237,6 +4495,29 @@ static inline bool tui_list_scroll_forward(tui_list_t* list)
  */
 static inline bool tui_list_scroll_backward(tui_list_t* list)
 {
+  if (list->bind)
+  {
+    if (list->data_index == 0)
+    {
+      return false;
+    }
+
+    list->data_index--;
+
+    if (list->item_index > 0)
+    {
+      list->item_index--;
+    }
+    else
+    {
+      list->_data_first--;
+
+      tui_list_rebind(list);
+    }
+
+    return true;
+  }
+
   for (size_t index = list->item_index; index-- > 0;)
   {
     tui_window_t* window = list->items[index];
@@ -3304,6 +4585,13 @@ void tui_window_set(tui_t* tui, tui_window_t* window)
 
     tui->window = window;
 
+    // Both windows can change appearance with focus, like the cursor
+    tui->cursor.is_active = false;
+
+    tui_window_dirty_set(last_window);
+
+    tui_window_dirty_set(window);
+
     if (last_window && last_window->event.exit)
     {
       last_window->event.exit(last_window);
@@ -3332,6 +4620,8 @@ void tui_menu_set(tui_t* tui, tui_menu_t* menu)
 {
   if (tui->menu == menu) return;
 
+  tui_dirty_set(tui);
+
   if (tui->menu && tui->menu->event.exit)
   {
     tui->menu->event.exit(tui->menu);
@@ -3423,8 +4713,199 @@ void tui_stop(tui_t* tui)
   tui->is_running = false;
 }
 
+/*
+ * Get current monotonic time in milliseconds
+ */
+static inline long tui_time_ms_get(void)
+{
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return time.tv_sec * 1000 + time.tv_nsec / 1000000;
+}
+
+/*
+ * Create timer, which fires every interval_ms milliseconds
+ *
+ * RETURN (tui_timer_t* timer)
+ * - NULL | Failed to create timer
+ */
+tui_timer_t* tui_timer_create(tui_t* tui, int interval_ms, void (*event) (tui_t* tui, tui_timer_t* timer), void* data)
+{
+  tui_timer_t* timer = malloc(sizeof(tui_timer_t));
+
+  if (!timer)
+  {
+    return NULL;
+  }
+
+  *timer = (tui_timer_t)
+  {
+    .interval_ms = interval_ms,
+    ._expire_ms  = tui_time_ms_get() + interval_ms,
+    .event       = event,
+    .tui         = tui,
+    .data        = data
+  };
+
+  tui_timer_t** temp_timers = realloc(tui->timers, sizeof(tui_timer_t*) * (tui->timer_count + 1));
+
+  if (!temp_timers)
+  {
+    free(timer);
+
+    return NULL;
+  }
+
+  tui->timers = temp_timers;
+
+  tui->timers[tui->timer_count++] = timer;
+
+  return timer;
+}
+
+/*
+ * Delete timer
+ */
+void tui_timer_delete(tui_t* tui, tui_timer_t** timer)
+{
+  if (!timer || !(*timer)) return;
+
+  for (size_t index = 0; index < tui->timer_count; index++)
+  {
+    if (tui->timers[index] != *timer) continue;
+
+    for (size_t shift = index; shift < (tui->timer_count - 1); shift++)
+    {
+      tui->timers[shift] = tui->timers[shift + 1];
+    }
+
+    tui->timer_count--;
+
+    break;
+  }
+
+  free(*timer);
+
+  *timer = NULL;
+}
+
+/*
+ * Get poll timeout in milliseconds until the next timer expires
+ *
+ * RETURN (int timeout_ms)
+ * - -1 | No timer exists, wait forever
+ */
+static inline int tui_timers_timeout_get(tui_t* tui)
+{
+  if (tui->timer_count == 0)
+  {
+    return -1;
+  }
+
+  long now_ms = tui_time_ms_get();
+
+  long timeout_ms = -1;
+
+  for (size_t index = 0; index < tui->timer_count; index++)
+  {
+    long expire_ms = tui->timers[index]->_expire_ms - now_ms;
+
+    if (timeout_ms == -1 || expire_ms < timeout_ms)
+    {
+      timeout_ms = expire_ms;
+    }
+  }
+
+  return MAX(timeout_ms, 0);
+}
+
+/*
+ * Trigger every timer that has expired and rearm it
+ */
+static inline void tui_timers_trigger(tui_t* tui)
+{
+  long now_ms = tui_time_ms_get();
+
+  for (size_t index = 0; index < tui->timer_count; index++)
+  {
+    tui_timer_t* timer = tui->timers[index];
+
+    if (now_ms < timer->_expire_ms) continue;
+
+    timer->_expire_ms = now_ms + timer->interval_ms;
+
+    if (timer->event)
+    {
+      timer->event(tui, timer);
+    }
+  }
+}
+
+/*
+ * Queue a scripted key, consumed before any terminal input
+ *
+ * Together with the headless screen this drives the main
+ * loop without a tty - KEY_CTRLC ends the script
+ *
+ * RETURN (int status)
+ * - 0 | Success
+ * - 1 | Failed to grow key queue
+ */
+int tui_key_inject(tui_t* tui, int key)
+{
+  if ((tui->_key_count == 0) || ((tui->_key_count & (tui->_key_count - 1)) == 0))
+  {
+    size_t new_size = (tui->_key_count == 0) ? 1 : (tui->_key_count * 2);
+
+    int* new_queue = realloc(tui->_key_queue, sizeof(int) * new_size);
+
+    if (!new_queue) return 1;
+
+    tui->_key_queue = new_queue;
+  }
+
+  tui->_key_queue[tui->_key_count++] = key;
+
+  return 0;
+}
+
+/*
+ * Get next key, scripted keys first then the terminal
+ */
+static inline int tui_key_get(tui_t* tui)
+{
+  if (tui->_key_index < tui->_key_count)
+  {
+    return tui->_key_queue[tui->_key_index++];
+  }
+
+  // The script has run dry
+  tui->_key_index = 0;
+
+  tui->_key_count = 0;
+
+  return wgetch(stdscr);
+}
+
+/*
+ * Wake up the main loop from another thread
+ */
+void tui_wake(tui_t* tui)
+{
+  if (write(tui->_wake_fds[1], "w", 1) == -1)
+  {
+    // The pipe is full, so the loop is already awake
+  }
+}
+
 /*
  * Start tui - main loop
+ *
+ * The loop sleeps in poll until input arrives, a timer
+ * expires or another thread calls tui_wake, and renders
+ * only when an event actually fired
  */
 void tui_start(tui_t* tui)
 {
@@ -3432,26 +4913,78 @@ void tui_start(tui_t* tui)
 
   tui_render(tui);
 
-  int key;
+  nodelay(stdscr, TRUE);
 
-  while (tui->is_running && (key = wgetch(stdscr)))
+  struct pollfd poll_fds[2] =
   {
-    if (key == KEY_CTRLC)
-    {
-      tui->is_running = false;
+    { .fd = STDIN_FILENO,      .events = POLLIN },
+    { .fd = tui->_wake_fds[0], .events = POLLIN }
+  };
+
+  while (tui->is_running)
+  {
+    // Scripted keys are already waiting, don't sleep on them
+    int timeout = (tui->_key_index < tui->_key_count) ? 0 : tui_timers_timeout_get(tui);
 
+    int status = poll(poll_fds, 2, timeout);
+
+    if (status == -1 && errno != EINTR)
+    {
       break;
     }
 
-    if (key == KEY_RESIZE)
+    // Drain the wakeup pipe
+    if (poll_fds[1].revents & POLLIN)
+    {
+      char buffer[64];
+
+      while (read(tui->_wake_fds[0], buffer, sizeof(buffer)) > 0);
+    }
+
+    // A signal, like SIGWINCH, queues input without data on the
+    // tty fd, so keys are drained after every wakeup
+    //
+    // The whole batch - a paste is delivered as one burst of
+    // keys - is dispatched before the single render below
+    int key;
+
+    bool is_resized = false;
+
+    while (tui->is_running && (key = tui_key_get(tui)) != ERR)
+    {
+      if (key == KEY_CTRLC)
+      {
+        tui->is_running = false;
+
+        break;
+      }
+
+      if (key == KEY_RESIZE)
+      {
+        // A drag delivers a storm of resizes, reflow once
+        is_resized = true;
+
+        continue;
+      }
+
+      tui_event(tui, key);
+    }
+
+    if (is_resized && tui->is_running)
     {
       tui_resize(tui);
+
+      tui_event(tui, KEY_RESIZE);
     }
 
-    tui_event(tui, key);
+    tui_async_drain(tui);
+
+    tui_timers_trigger(tui);
 
     tui_render(tui);
   }
+
+  nodelay(stdscr, FALSE);
 }
 
 /*
@@ -3762,8 +5295,26 @@ tui_window_t* tui_menu_window_search(tui_menu_t* menu, char* search)
   return tui_windows_window_search(menu->windows, menu->window_count, search);
 }
 
+/*
+ * Get search cache slot for search from base window
+ */
+static inline tui_search_slot_t* tui_search_slot_get(tui_window_t* base, char* search)
+{
+  size_t hash = (size_t) base >> 4;
+
+  for (char* letter = search; *letter; letter++)
+  {
+    hash = hash * 31 + *letter;
+  }
+
+  return &base->tui->_search_cache[hash % TUI_SEARCH_CACHE_SIZE];
+}
+
 /*
  * Search window from base window
+ *
+ * Resolved searches are memoized per base window and search path,
+ * and stay valid until a window is appended or freed
  */
 tui_window_t* tui_window_window_search(tui_window_t* window, char* search)
 {
@@ -3773,35 +5324,61 @@ tui_window_t* tui_window_window_search(tui_window_t* window, char* search)
     return window;
   }
 
+  tui_search_slot_t* slot = tui_search_slot_get(window, search);
+
+  if (slot->window && slot->base == window &&
+      slot->generation == window->tui->_search_generation &&
+      slot->search && strcmp(slot->search, search) == 0)
+  {
+    return slot->window;
+  }
+
   char* rest = strchr(search, ' ');
 
   size_t length = rest ? (rest - search) : strlen(search);
 
+  tui_window_t* found = NULL;
+
   if (length == 1 && *search == '.')
   {
     if (!rest)
     {
-      return (tui_window_t*) window->parent;
+      found = (tui_window_t*) window->parent;
     }
     else if (window->parent)
     {
-      return tui_window_window_search((tui_window_t*) window->parent, rest + 1);
+      found = tui_window_window_search((tui_window_t*) window->parent, rest + 1);
     }
     else if (window->menu)
     {
-      return tui_menu_window_search(window->menu, rest + 1);
+      found = tui_menu_window_search(window->menu, rest + 1);
+    }
+    else
+    {
+      found = tui_window_search(window->tui, rest + 1);
     }
-
-    return tui_window_search(window->tui, rest + 1);
   }
   else if (window->type == TUI_WINDOW_PARENT)
   {
     tui_window_parent_t* parent = (tui_window_parent_t*) window;
 
-    return tui_windows_window_search(parent->children, parent->child_count, search);
+    found = tui_windows_window_search(parent->children, parent->child_count, search);
   }
-  
-  return NULL;
+
+  if (found)
+  {
+    free(slot->search);
+
+    *slot = (tui_search_slot_t)
+    {
+      .base       = window,
+      .search     = strdup(search),
+      .window     = found,
+      .generation = window->tui->_search_generation
+    };
+  }
+
+  return found;
 }
 
 /*